@@ -402,6 +402,7 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
   int this_run, main_element, aligned_bits, j, warned = 0;
   unsigned char *window, *runsrc, *rundest, buf[12];
   unsigned int frame_size=0, end_frame, match_offset, window_posn;
+  unsigned int window_size;
   unsigned int R0, R1, R2;
 
   /* easy answers */
@@ -424,6 +425,11 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
   /* restore local state */
   RESTORE_BITS;
   window = lzx->window;
+  /* keep the window size in a local so the compiler can hold it in a
+   * register across the match-copy loops instead of reloading it
+   * through lzx on every wrap/bounds check. it never changes after
+   * lzxd_init(). */
+  window_size = lzx->window_size;
   window_posn = lzx->window_posn;
   R0 = lzx->R0;
   R1 = lzx->R1;
@@ -608,7 +614,7 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
                 match_length += extra_len;
             }
 
-            if ((window_posn + match_length) > lzx->window_size) {
+            if ((window_posn + match_length) > window_size) {
               D(("match ran over window wrap"))
               return lzx->error = MSPACK_ERR_DECRUNCH;
             }
@@ -626,11 +632,11 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
               }
               /* j = length from match offset to end of window */
               j = match_offset - window_posn;
-              if (j > (int) lzx->window_size) {
+              if (j > (int) window_size) {
                 D(("match offset beyond window boundaries"))
                 return lzx->error = MSPACK_ERR_DECRUNCH;
               }
-              runsrc = &window[lzx->window_size - j];
+              runsrc = &window[window_size - j];
               if (j < i) {
                 /* if match goes over the window edge, do two copy runs */
                 i -= j; while (j-- > 0) *rundest++ = *runsrc++;
@@ -732,7 +738,7 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
                 match_length += extra_len;
             }
 
-            if ((window_posn + match_length) > lzx->window_size) {
+            if ((window_posn + match_length) > window_size) {
               D(("match ran over window wrap"))
               return lzx->error = MSPACK_ERR_DECRUNCH;
             }
@@ -750,11 +756,11 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
               }
               /* j = length from match offset to end of window */
               j = match_offset - window_posn;
-              if (j > (int) lzx->window_size) {
+              if (j > (int) window_size) {
                 D(("match offset beyond window boundaries"))
                 return lzx->error = MSPACK_ERR_DECRUNCH;
               }
-              runsrc = &window[lzx->window_size - j];
+              runsrc = &window[window_size - j];
               if (j < i) {
                 /* if match goes over the window edge, do two copy runs */
                 i -= j; while (j-- > 0) *rundest++ = *runsrc++;
@@ -874,8 +880,8 @@ int lzxd_decompress(struct lzxd_stream *lzx, off_t out_bytes) {
     lzx->frame++;
 
     /* wrap window / frame position pointers */
-    if (window_posn == lzx->window_size)     window_posn = 0;
-    if (lzx->frame_posn == lzx->window_size) lzx->frame_posn = 0;
+    if (window_posn == window_size)     window_posn = 0;
+    if (lzx->frame_posn == window_size) lzx->frame_posn = 0;
 
   } /* while (lzx->frame < end_frame) */
 
@@ -14,6 +14,10 @@
 #include <string.h>
 #include <sys/types.h>
 
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
 #include "lzx.h"
 #include "mspack.h"
 
@@ -27,103 +31,156 @@
 # define min(x, y) ((x) < (y) ? (x) : (y))
 #endif
 
+// The mspack_memory_* callbacks are only used within this file
+// (through the mspack_system function pointers), so they can be
+// static. read/write are the per-block I/O hot path.
+#if defined(__GNUC__)
+# define LZX_HOT __attribute__((hot))
+#else
+# define LZX_HOT
+#endif
+
+// Use __builtin_memcpy() where available so the compiler can expand
+// small copies inline instead of always calling into libc. The block
+// sizes here are runtime values, but the builtin still lets the
+// compiler pick the best expansion for the target.
+#if defined(__GNUC__)
+# define lzx_memcpy __builtin_memcpy
+#else
+# define lzx_memcpy memcpy
+#endif
+
 typedef struct mspack_memory_file_t {
   struct mspack_system sys;
   void* buffer;
   off_t buffer_size;
   off_t offset;
 } mspack_memory_file;
-mspack_memory_file* mspack_memory_open(struct mspack_system* sys, void* buffer,
-                                       const size_t buffer_size) {
-  mspack_memory_file* memfile;
-  ((void)sys);
-
-  assert_true(buffer_size < INT_MAX);
-  if (buffer_size >= INT_MAX) {
-    return NULL;
-  }
-  memfile = (mspack_memory_file*)calloc(1, sizeof(mspack_memory_file));
-  if (!memfile) {
-    return NULL;
-  }
-  memfile->buffer = buffer;
-  memfile->buffer_size = (off_t)buffer_size;
-  memfile->offset = 0;
-  return memfile;
-}
-void mspack_memory_close(mspack_memory_file* file) {
-  mspack_memory_file* memfile = (mspack_memory_file*)file;
-  free(memfile);
-}
-int mspack_memory_read(struct mspack_file* file, void* buffer, int chars) {
+static LZX_HOT int mspack_memory_read(struct mspack_file* file, void* buffer, int chars) {
   mspack_memory_file* memfile = (mspack_memory_file*)file;
   const off_t remaining = memfile->buffer_size - memfile->offset;
   const off_t total = min((off_t)chars, remaining);
-  memcpy(buffer, (uint8_t*)memfile->buffer + memfile->offset, total);
+  lzx_memcpy(buffer, (uint8_t*)memfile->buffer + memfile->offset, total);
   memfile->offset += total;
   return (int)total;
 }
-int mspack_memory_write(struct mspack_file* file, void* buffer, int chars) {
+static LZX_HOT int mspack_memory_write(struct mspack_file* file, void* buffer, int chars) {
   mspack_memory_file* memfile = (mspack_memory_file*)file;
   const off_t remaining = memfile->buffer_size - memfile->offset;
   const off_t total = min((off_t)chars, remaining);
-  memcpy((uint8_t*)memfile->buffer + memfile->offset, buffer, total);
+  lzx_memcpy((uint8_t*)memfile->buffer + memfile->offset, buffer, total);
   memfile->offset += total;
   return (int)total;
 }
-void* mspack_memory_alloc(struct mspack_system* sys, size_t chars) {
+// The largest allocation made through this callback is the LZX
+// sliding window, which the match-copy loops stream over constantly.
+// Align it to the cache line size (64 bytes) so window accesses
+// never straddle a line unnecessarily.
+// NOTE: Callers rely on this returning zeroed memory. (see lzx_decompress())
+static void* mspack_memory_alloc(struct mspack_system* sys, size_t chars) {
   ((void)sys);
+#if defined(_MSC_VER)
+  void* ptr = _aligned_malloc(chars, 64);
+  if (ptr) {
+    memset(ptr, 0, chars);
+  }
+  return ptr;
+#elif defined(__unix__) || defined(__APPLE__)
+  void* ptr;
+  if (posix_memalign(&ptr, 64, chars) != 0) {
+    return NULL;
+  }
+  memset(ptr, 0, chars);
+  return ptr;
+#else
   return calloc(chars, 1);
+#endif
 }
-void mspack_memory_free(void* ptr) { free(ptr); }
-void mspack_memory_copy(void* src, void* dest, size_t chars) {
-  memcpy(dest, src, chars);
+static void mspack_memory_free(void* ptr) {
+#if defined(_MSC_VER)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
 }
-struct mspack_system* mspack_memory_sys_create() {
-  struct mspack_system* sys =
-      (struct mspack_system*)calloc(1, sizeof(struct mspack_system));
-  if (!sys) {
-    return NULL;
-  }
-  sys->read = mspack_memory_read;
-  sys->write = mspack_memory_write;
-  sys->alloc = mspack_memory_alloc;
-  sys->free = mspack_memory_free;
-  sys->copy = mspack_memory_copy;
-  return sys;
+// sys->copy is called for every frame copied out of the LZX window,
+// so use lzx_memcpy here as well: the builtin lets the compiler
+// avoid memcpy's entry-point size dispatch for these copies.
+static LZX_HOT void mspack_memory_copy(void* src, void* dest, size_t chars) {
+  lzx_memcpy(dest, src, chars);
 }
-void mspack_memory_sys_destroy(struct mspack_system* sys) { free(sys); }
+// In-memory mspack_system vtable.
+// All callbacks are stateless, so a single static const
+// instance can be shared by every lzx_decompress() call.
+static const struct mspack_system mspack_memory_sys = {
+  NULL,  /* open */
+  NULL,  /* close */
+  mspack_memory_read,
+  mspack_memory_write,
+  NULL,  /* seek */
+  NULL,  /* tell */
+  NULL,  /* message */
+  mspack_memory_alloc,
+  mspack_memory_free,
+  mspack_memory_copy,
+  NULL,  /* null_ptr */
+};
 
 int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
                    size_t dest_len, uint32_t window_size, void* window_data,
                    size_t window_data_len) {
-  uint32_t window_bits = 0;
-  uint32_t temp_sz = window_size;
-  size_t m;
+  uint32_t window_bits;
   int result_code = 1;
 
-  struct mspack_system* sys;
-  mspack_memory_file* lzxsrc;
-  mspack_memory_file* lzxdst;
+  // In-memory file descriptors.
+  // These only live for the duration of this call,
+  // so they can be stack-allocated instead of being
+  // calloc'd and freed on every decompress.
+  mspack_memory_file lzxsrc;
+  mspack_memory_file lzxdst;
   struct lzxd_stream* lzxd;
 
-  for (m = 0; m < 32; m++, window_bits++) {
-    temp_sz >>= 1;
-    if (temp_sz == 0x00000000) {
-      break;
+  assert_true(lzx_len < INT_MAX);
+  assert_true(dest_len < INT_MAX);
+  if (lzx_len >= INT_MAX || dest_len >= INT_MAX) {
+    return 1;
+  }
+
+  // window_bits = log2(window_size)
+  // (window_size is always a power of two)
+#if defined(__GNUC__)
+  window_bits = (window_size == 0) ? 0 : (31u - (uint32_t)__builtin_clz(window_size));
+#elif defined(_MSC_VER)
+  {
+    unsigned long index;
+    window_bits = _BitScanReverse(&index, window_size) ? (uint32_t)index : 0;
+  }
+#else
+  {
+    uint32_t temp_sz = window_size;
+    for (window_bits = 0; temp_sz > 1; window_bits++) {
+      temp_sz >>= 1;
     }
   }
+#endif
+
+  lzxsrc.buffer = (void*)lzx_data;
+  lzxsrc.buffer_size = (off_t)lzx_len;
+  lzxsrc.offset = 0;
+  lzxdst.buffer = dest;
+  lzxdst.buffer_size = (off_t)dest_len;
+  lzxdst.offset = 0;
 
-  sys = mspack_memory_sys_create();
-  lzxsrc = mspack_memory_open(sys, (void*)lzx_data, lzx_len);
-  lzxdst = mspack_memory_open(sys, dest, dest_len);
-  lzxd = lzxd_init(sys, (struct mspack_file*)lzxsrc, (struct mspack_file*)lzxdst,
+  lzxd = lzxd_init((struct mspack_system*)&mspack_memory_sys,
+                (struct mspack_file*)&lzxsrc, (struct mspack_file*)&lzxdst,
                 window_bits, 0, 0x8000, (off_t)dest_len, 0);
 
   if (lzxd) {
     if (window_data) {
-      // zero the window and then copy window_data to the end of it
-      memset(lzxd->window, 0, window_data_len);
+      // Copy window_data to the end of the window.
+      // NOTE: The window does not need to be zeroed here:
+      // lzxd_init() allocates it through mspack_memory_alloc(),
+      // which always returns zeroed memory.
       memcpy(lzxd->window + (window_size - window_data_len), window_data,
                   window_data_len);
       lzxd->ref_data_size = (uint32_t)window_data_len;
@@ -134,18 +191,6 @@ int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
     lzxd_free(lzxd);
     lzxd = NULL;
   }
-  if (lzxsrc) {
-    mspack_memory_close(lzxsrc);
-    lzxsrc = NULL;
-  }
-  if (lzxdst) {
-    mspack_memory_close(lzxdst);
-    lzxdst = NULL;
-  }
-  if (sys) {
-    mspack_memory_sys_destroy(sys);
-    sys = NULL;
-  }
 
   return result_code;
 }
@@ -19,6 +19,23 @@
 #include "librpbase/img/rp_image.hpp"
 using LibRpBase::rp_image;
 
+/**
+ * Handle an unsupported rp_image format.
+ * Marked cold and noinline so the error path is laid out away
+ * from the hot ARGB32/CI8 conversion loops.
+ * @param pixbuf	[in] GdkPixbuf to unreference.
+ * @return nullptr.
+ */
+#ifdef __GNUC__
+__attribute__((cold, noinline))
+#endif
+static GdkPixbuf *rp_gdkPixbuf_format_error(GdkPixbuf *pixbuf)
+{
+	assert(!"Unsupported rp_image::Format.");
+	g_object_unref(pixbuf);
+	return nullptr;
+}
+
 /**
  * Convert an rp_image to GdkPixbuf.
  * Standard version using regular C++ code.
@@ -48,6 +65,31 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_cpp(const rp_image *img)
 			// Copy the image data.
 			const uint32_t *img_buf = static_cast<const uint32_t*>(img->bits());
 			const int src_stride_adj = (img->stride() / sizeof(uint32_t)) - width;
+
+			if (src_stride_adj == 0 && dest_stride_adj == 0) {
+				// Both buffers are contiguous.
+				// Process the whole image as a single row. This removes
+				// the per-row loop epilogues and lets the hardware
+				// prefetcher stream without restarting on each row.
+				unsigned int x = (unsigned int)width * (unsigned int)height;
+				for (; x > 1; x -= 2, img_buf += 2, px_dest += 2) {
+					// Swap the R and B channels.
+					px_dest[0] = (img_buf[0] & 0xFF00FF00) |
+						    ((img_buf[0] & 0x00FF0000) >> 16) |
+						    ((img_buf[0] & 0x000000FF) << 16);
+					px_dest[1] = (img_buf[1] & 0xFF00FF00) |
+						    ((img_buf[1] & 0x00FF0000) >> 16) |
+						    ((img_buf[1] & 0x000000FF) << 16);
+				}
+				if (x == 1) {
+					// Last pixel.
+					*px_dest = (*img_buf & 0xFF00FF00) |
+						  ((*img_buf & 0x00FF0000) >> 16) |
+						  ((*img_buf & 0x000000FF) << 16);
+				}
+				break;
+			}
+
 			for (unsigned int y = (unsigned int)height; y > 0; y--) {
 				unsigned int x;
 				for (x = (unsigned int)width; x > 1; x -= 2) {
@@ -78,41 +120,33 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_cpp(const rp_image *img)
 		}
 
 		case rp_image::FORMAT_CI8: {
-			const uint32_t *src_pal = img->palette();
-			const int src_pal_len = img->palette_len();
-			assert(src_pal != nullptr);
-			assert(src_pal_len > 0);
-			if (!src_pal || src_pal_len <= 0)
+			// Get the R/B-swapped palette. (cached in rp_image)
+			const uint32_t *palette = img->palette_bswapped();
+			assert(palette != nullptr);
+			if (unlikely(!palette))
 				break;
 
-			// Get the palette.
-			uint32_t palette[256];
-			int i;
-			for (i = 0; i < src_pal_len; i += 2, src_pal += 2) {
-				// Swap the R and B channels in the palette.
-				palette[i+0] = (src_pal[0] & 0xFF00FF00) |
-					      ((src_pal[0] & 0x00FF0000) >> 16) |
-					      ((src_pal[0] & 0x000000FF) << 16);
-				palette[i+1] = (src_pal[1] & 0xFF00FF00) |
-					      ((src_pal[1] & 0x00FF0000) >> 16) |
-					      ((src_pal[1] & 0x000000FF) << 16);
-			}
-			for (; i < src_pal_len; i++, src_pal++) {
-				// Last color.
-				palette[i] = (*src_pal & 0xFF00FF00) |
-					    ((*src_pal & 0x00FF0000) >> 16) |
-					    ((*src_pal & 0x000000FF) << 16);
-			}
-
-			// Zero out the rest of the palette if the new
-			// palette is larger than the old palette.
-			if (src_pal_len < ARRAY_SIZE(palette)) {
-				memset(&palette[src_pal_len], 0, (ARRAY_SIZE(palette) - src_pal_len) * sizeof(uint32_t));
-			}
-
 			// Copy the image data.
 			const uint8_t *img_buf = static_cast<const uint8_t*>(img->bits());
 			const int src_stride_adj = img->stride() - width;
+
+			if (src_stride_adj == 0 && dest_stride_adj == 0) {
+				// Both buffers are contiguous.
+				// Process the whole image as a single row.
+				unsigned int x = (unsigned int)width * (unsigned int)height;
+				for (; x > 3; x -= 4, px_dest += 4, img_buf += 4) {
+					px_dest[0] = palette[img_buf[0]];
+					px_dest[1] = palette[img_buf[1]];
+					px_dest[2] = palette[img_buf[2]];
+					px_dest[3] = palette[img_buf[3]];
+				}
+				for (; x > 0; x--, px_dest++, img_buf++) {
+					// Last pixels.
+					*px_dest = palette[*img_buf];
+				}
+				break;
+			}
+
 			for (unsigned int y = (unsigned int)height; y > 0; y--) {
 				unsigned int x;
 				for (x = (unsigned int)width; x > 3; x -= 4) {
@@ -126,8 +160,6 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_cpp(const rp_image *img)
 				for (; x > 0; x--, px_dest++, img_buf++) {
 					// Last pixels.
 					*px_dest = palette[*img_buf];
-					px_dest++;
-					img_buf++;
 				}
 
 				// Next line.
@@ -139,9 +171,7 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_cpp(const rp_image *img)
 
 		default:
 			// Unsupported image format.
-			assert(!"Unsupported rp_image::Format.");
-			g_object_unref(pixbuf);
-			pixbuf = nullptr;
+			pixbuf = rp_gdkPixbuf_format_error(pixbuf);
 			break;
 	}
 
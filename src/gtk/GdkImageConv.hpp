@@ -21,7 +21,26 @@ namespace LibRpBase {
 
 #if defined(RP_CPU_I386) || defined(RP_CPU_AMD64)
 # include "librpbase/cpuflags_x86.h"
+# define GDKIMAGECONV_HAS_SSE2 1
 # define GDKIMAGECONV_HAS_SSSE3 1
+# define GDKIMAGECONV_HAS_AVX2 1
+# define GDKIMAGECONV_HAS_AVX512BW 1
+#endif
+#if defined(RP_CPU_ARM) || defined(RP_CPU_ARM64)
+// NEON is part of the ARMv8 baseline. On 32-bit ARM, the NEON
+// version is only built if the toolchain has NEON enabled.
+# ifdef __ARM_NEON
+#  define GDKIMAGECONV_HAS_NEON 1
+# endif
+#endif
+
+// Code layout hint: the converter functions can be called in tight
+// listview loops, so ask the compiler to optimize them more
+// aggressively and keep them in a hot text section.
+#ifdef __GNUC__
+# define GDKIMAGECONV_ATTR_HOT __attribute__((hot))
+#else
+# define GDKIMAGECONV_ATTR_HOT
 #endif
 
 class GdkImageConv
@@ -39,7 +58,17 @@ class GdkImageConv
 		 * @param img	[in] rp_image.
 		 * @return GdkPixbuf, or nullptr on error.
 		 */
-		static GdkPixbuf *rp_image_to_GdkPixbuf_cpp(const LibRpBase::rp_image *img);
+		static GDKIMAGECONV_ATTR_HOT GdkPixbuf *rp_image_to_GdkPixbuf_cpp(const LibRpBase::rp_image *img);
+
+#ifdef GDKIMAGECONV_HAS_SSE2
+		/**
+		 * Convert an rp_image to GdkPixbuf.
+		 * SSE2-optimized version.
+		 * @param img	[in] rp_image.
+		 * @return GdkPixbuf, or nullptr on error.
+		 */
+		static GdkPixbuf *rp_image_to_GdkPixbuf_sse2(const LibRpBase::rp_image *img);
+#endif /* GDKIMAGECONV_HAS_SSE2 */
 
 #ifdef GDKIMAGECONV_HAS_SSSE3
 		/**
@@ -51,6 +80,36 @@ class GdkImageConv
 		static GdkPixbuf *rp_image_to_GdkPixbuf_ssse3(const LibRpBase::rp_image *img);
 #endif /* GDKIMAGECONV_HAS_SSSE3 */
 
+#ifdef GDKIMAGECONV_HAS_AVX2
+		/**
+		 * Convert an rp_image to GdkPixbuf.
+		 * AVX2-optimized version.
+		 * @param img	[in] rp_image.
+		 * @return GdkPixbuf, or nullptr on error.
+		 */
+		static GdkPixbuf *rp_image_to_GdkPixbuf_avx2(const LibRpBase::rp_image *img);
+#endif /* GDKIMAGECONV_HAS_AVX2 */
+
+#ifdef GDKIMAGECONV_HAS_AVX512BW
+		/**
+		 * Convert an rp_image to GdkPixbuf.
+		 * AVX-512BW-optimized version.
+		 * @param img	[in] rp_image.
+		 * @return GdkPixbuf, or nullptr on error.
+		 */
+		static GdkPixbuf *rp_image_to_GdkPixbuf_avx512bw(const LibRpBase::rp_image *img);
+#endif /* GDKIMAGECONV_HAS_AVX512BW */
+
+#ifdef GDKIMAGECONV_HAS_NEON
+		/**
+		 * Convert an rp_image to GdkPixbuf.
+		 * NEON-optimized version.
+		 * @param img	[in] rp_image.
+		 * @return GdkPixbuf, or nullptr on error.
+		 */
+		static GdkPixbuf *rp_image_to_GdkPixbuf_neon(const LibRpBase::rp_image *img);
+#endif /* GDKIMAGECONV_HAS_NEON */
+
 		/**
 		 * Convert an rp_image to GdkPixbuf.
 		 * @param img	[in] rp_image.
@@ -71,14 +130,34 @@ class GdkImageConv
  */
 inline GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf(const LibRpBase::rp_image *img)
 {
+#ifdef GDKIMAGECONV_HAS_NEON
+	// NEON is always available if this macro is defined.
+	return rp_image_to_GdkPixbuf_neon(img);
+#else
+#ifdef GDKIMAGECONV_HAS_AVX512BW
+	if (RP_CPU_HasAVX512BW()) {
+		return rp_image_to_GdkPixbuf_avx512bw(img);
+	} else
+#endif /* GDKIMAGECONV_HAS_AVX512BW */
+#ifdef GDKIMAGECONV_HAS_AVX2
+	if (RP_CPU_HasAVX2()) {
+		return rp_image_to_GdkPixbuf_avx2(img);
+	} else
+#endif /* GDKIMAGECONV_HAS_AVX2 */
 #ifdef GDKIMAGECONV_HAS_SSSE3
 	if (RP_CPU_HasSSSE3()) {
 		return rp_image_to_GdkPixbuf_ssse3(img);
 	} else
 #endif /* GDKIMAGECONV_HAS_SSSE3 */
+#ifdef GDKIMAGECONV_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return rp_image_to_GdkPixbuf_sse2(img);
+	} else
+#endif /* GDKIMAGECONV_HAS_SSE2 */
 	{
 		return rp_image_to_GdkPixbuf_cpp(img);
 	}
+#endif /* GDKIMAGECONV_HAS_NEON */
 }
 
 #endif /* !defined(RP_HAS_IFUNC) || (!defined(RP_CPU_I386) && !defined(RP_CPU_AMD64)) */
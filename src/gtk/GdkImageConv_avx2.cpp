@@ -0,0 +1,219 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (GTK+ common)                      *
+ * GdkImageConv.cpp: Helper functions to convert from rp_image to GDK.     *
+ *                                                                         *
+ * Copyright (c) 2017-2019 by David Korth.                                 *
+ * SPDX-License-Identifier: GPL-2.0-or-later                               *
+ ***************************************************************************/
+
+#include "GdkImageConv.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cstring>
+
+// librpbase
+#include "librpbase/aligned_malloc.h"
+#include "librpbase/img/rp_image.hpp"
+using LibRpBase::rp_image;
+
+// AVX2 headers.
+#include <immintrin.h>
+
+// Non-temporal store threshold.
+// For images larger than this, bypass the cache on stores:
+// the destination is consumed by GTK/X, not re-read by the CPU,
+// so there's no point in polluting L2/L3 with the writebacks.
+static const size_t NT_THRESHOLD = 256U*1024U;
+
+// Cache tile size, in pixels.
+// Contiguous images are converted in tiles of this many pixels so
+// each tile's source data (~256 KiB) stays L2-resident while the
+// (often non-temporal) stores stream to the destination.
+static const unsigned int TILE_PX = (unsigned int)(NT_THRESHOLD / sizeof(uint32_t));
+
+/**
+ * Store a 256-bit value, optionally using a non-temporal store.
+ * @param p	[out] Destination. (must be 32-byte aligned)
+ * @param v	[in] Value.
+ * @param nt	[in] If true, use a non-temporal store.
+ */
+static FORCEINLINE void rp_store_si256(__m256i *p, __m256i v, bool nt)
+{
+	if (nt) {
+		_mm256_stream_si256(p, v);
+	} else {
+		_mm256_store_si256(p, v);
+	}
+}
+
+/**
+ * GdkPixbufDestroyNotify() callback.
+ * @param pixels Pixel data.
+ * @param data Other data. (unused)
+ */
+static void rp_gdkPixbufDestroyNotify(guchar *pixels, gpointer data)
+{
+	RP_UNUSED(data);
+	aligned_free(pixels);
+}
+
+/**
+ * Convert an rp_image to GdkPixbuf.
+ * AVX2-optimized version.
+ * @param img	[in] rp_image.
+ * @return GdkPixbuf, or nullptr on error.
+ */
+GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_avx2(const rp_image *img)
+{
+	assert(img != nullptr);
+	if (unlikely(!img || !img->isValid()))
+		return nullptr;
+
+	// We need to allocate our own image buffer, since GdkPixbuf
+	// only guarantees 4-byte alignment.
+	const int width = img->width();
+	const int height = img->height();
+	const int rowstride = ALIGN(32, width * sizeof(uint32_t));
+	uint32_t *px_dest = static_cast<uint32_t*>(aligned_malloc(32, height * rowstride));
+	assert(px_dest != nullptr);
+	if (unlikely(!px_dest)) {
+		// Unable to allocate memory.
+		return nullptr;
+	}
+
+	GdkPixbuf *pixbuf = gdk_pixbuf_new_from_data(
+		reinterpret_cast<const guchar*>(px_dest),
+		GDK_COLORSPACE_RGB, true, 8, width, height,
+		rowstride, rp_gdkPixbufDestroyNotify, nullptr);
+	assert(pixbuf != nullptr);
+	if (unlikely(!pixbuf)) {
+		// Unable to create a GdkPixbuf.
+		aligned_free(px_dest);
+		return nullptr;
+	}
+
+	// Sanity check: Make sure rowstride is correct.
+	assert(gdk_pixbuf_get_rowstride(pixbuf) == rowstride);
+	const int dest_stride_adj = (rowstride / sizeof(*px_dest)) - img->width();
+
+	// Use non-temporal stores for large images.
+	const bool use_nt = ((size_t)width * (size_t)height * sizeof(uint32_t)) > NT_THRESHOLD;
+
+	// ABGR shuffle mask. (VPSHUFB is lane-local, so the
+	// same 16-byte mask is used for both 128-bit lanes.)
+	const __m256i shuf_mask = _mm256_setr_epi8(
+		2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15,
+		2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+
+	switch (img->format()) {
+		case rp_image::FORMAT_ARGB32: {
+			// Copy the image data.
+			const uint32_t *img_buf = static_cast<const uint32_t*>(img->bits());
+			const int src_stride_adj = (img->stride() / sizeof(uint32_t)) - width;
+
+			// If both buffers are contiguous, fuse the rows and
+			// split the fused run into L2-sized tiles. Each tile's
+			// source footprint stays cache-resident while the
+			// stores stream to the destination.
+			unsigned int row_width = (unsigned int)width, rows = (unsigned int)height;
+			unsigned int px_remaining = 0;
+			if (src_stride_adj == 0 && dest_stride_adj == 0) {
+				px_remaining = (unsigned int)(width * height);
+				rows = (px_remaining + TILE_PX - 1) / TILE_PX;
+			}
+
+			for (unsigned int y = rows; y > 0; y--) {
+				// Process 16 pixels per iteration using AVX2.
+				unsigned int x = row_width;
+				if (px_remaining != 0) {
+					// Contiguous: next L2-sized tile.
+					x = (px_remaining > TILE_PX ? TILE_PX : px_remaining);
+					px_remaining -= x;
+				}
+				for (; x > 15; x -= 16, px_dest += 16, img_buf += 16) {
+					const __m256i *ymm_src = reinterpret_cast<const __m256i*>(img_buf);
+					__m256i *ymm_dest = reinterpret_cast<__m256i*>(px_dest);
+
+					__m256i sa = _mm256_loadu_si256(&ymm_src[0]);
+					__m256i sb = _mm256_loadu_si256(&ymm_src[1]);
+
+					__m256i val = _mm256_shuffle_epi8(sa, shuf_mask);
+					rp_store_si256(&ymm_dest[0], val, use_nt);
+
+					val = _mm256_shuffle_epi8(sb, shuf_mask);
+					rp_store_si256(&ymm_dest[1], val, use_nt);
+				}
+
+				// Remaining pixels.
+				for (; x > 0; x--) {
+					// Last pixel.
+					*px_dest = (*img_buf & 0xFF00FF00) |
+						  ((*img_buf & 0x00FF0000) >> 16) |
+						  ((*img_buf & 0x000000FF) << 16);
+					img_buf++;
+					px_dest++;
+				}
+
+				// Next line.
+				img_buf += src_stride_adj;
+				px_dest += dest_stride_adj;
+			}
+			break;
+		}
+
+		case rp_image::FORMAT_CI8: {
+			// Get the R/B-swapped palette. (cached in rp_image)
+			const uint32_t *palette = img->palette_bswapped();
+			assert(palette != nullptr);
+			if (unlikely(!palette))
+				break;
+
+			// Convert the image data from CI8 to ARGB32.
+			const uint8_t *img_buf = static_cast<const uint8_t*>(img->bits());
+			const int src_stride_adj = img->stride() - width;
+			for (unsigned int y = (unsigned int)height; y > 0; y--) {
+				// Process 8 pixels per iteration using VPGATHERDD.
+				// The palette fits in L1 (1 KiB), so the gather
+				// collapses the four dependent scalar loads into
+				// a single instruction.
+				unsigned int x = (unsigned int)width;
+				for (; x > 7; x -= 8, px_dest += 8, img_buf += 8) {
+					// Zero-extend 8 palette indexes to 32-bit.
+					const __m128i idx8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(img_buf));
+					const __m256i idx32 = _mm256_cvtepu8_epi32(idx8);
+					const __m256i px = _mm256_i32gather_epi32(
+						reinterpret_cast<const int*>(palette), idx32, sizeof(uint32_t));
+					rp_store_si256(reinterpret_cast<__m256i*>(px_dest), px, use_nt);
+				}
+				for (; x > 0; x--, px_dest++, img_buf++) {
+					// Last pixels.
+					*px_dest = palette[*img_buf];
+				}
+
+				// Next line.
+				img_buf += src_stride_adj;
+				px_dest += dest_stride_adj;
+			}
+
+			break;
+		}
+
+		default:
+			// Unsupported image format.
+			assert(!"Unsupported rp_image::Format.");
+			g_object_unref(pixbuf);
+			pixbuf = nullptr;
+			break;
+	}
+
+	if (use_nt) {
+		// Flush the write-combining buffers.
+		_mm_sfence();
+	}
+
+	return pixbuf;
+}
@@ -23,11 +23,26 @@ extern "C" {
  */
 static __typeof__(&GdkImageConv::rp_image_to_GdkPixbuf_cpp) rp_image_to_GdkPixbuf_resolve(void)
 {
+#ifdef GDKIMAGECONV_HAS_AVX512BW
+	if (RP_CPU_HasAVX512BW()) {
+		return &GdkImageConv::rp_image_to_GdkPixbuf_avx512bw;
+	} else
+#endif /* GDKIMAGECONV_HAS_AVX512BW */
+#ifdef GDKIMAGECONV_HAS_AVX2
+	if (RP_CPU_HasAVX2()) {
+		return &GdkImageConv::rp_image_to_GdkPixbuf_avx2;
+	} else
+#endif /* GDKIMAGECONV_HAS_AVX2 */
 #ifdef GDKIMAGECONV_HAS_SSSE3
 	if (RP_CPU_HasSSSE3()) {
 		return &GdkImageConv::rp_image_to_GdkPixbuf_ssse3;
 	} else
 #endif /* GDKIMAGECONV_HAS_SSSE3 */
+#ifdef GDKIMAGECONV_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return &GdkImageConv::rp_image_to_GdkPixbuf_sse2;
+	} else
+#endif /* GDKIMAGECONV_HAS_SSE2 */
 	{
 		return &GdkImageConv::rp_image_to_GdkPixbuf_cpp;
 	}
@@ -0,0 +1,130 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (GTK+ common)                      *
+ * GdkImageConv.cpp: Helper functions to convert from rp_image to GDK.     *
+ *                                                                         *
+ * Copyright (c) 2017-2019 by David Korth.                                 *
+ * SPDX-License-Identifier: GPL-2.0-or-later                               *
+ ***************************************************************************/
+
+#include "GdkImageConv.hpp"
+
+#ifdef GDKIMAGECONV_HAS_NEON
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cstring>
+
+// librpbase
+#include "librpbase/img/rp_image.hpp"
+using LibRpBase::rp_image;
+
+// NEON headers.
+#include <arm_neon.h>
+
+/**
+ * Convert an rp_image to GdkPixbuf.
+ * NEON-optimized version.
+ * @param img	[in] rp_image.
+ * @return GdkPixbuf, or nullptr on error.
+ */
+GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_neon(const rp_image *img)
+{
+	assert(img != nullptr);
+	if (unlikely(!img || !img->isValid()))
+		return nullptr;
+
+	// NOTE: GdkPixbuf's convenience functions don't do a
+	// deep copy, so we can't use them directly.
+	const int width = img->width();
+	const int height = img->height();
+	GdkPixbuf *pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, true, 8, width, height);
+	assert(pixbuf != nullptr);
+	if (unlikely(!pixbuf))
+		return nullptr;
+
+	uint32_t *px_dest = reinterpret_cast<uint32_t*>(gdk_pixbuf_get_pixels(pixbuf));
+	const int dest_stride_adj = (gdk_pixbuf_get_rowstride(pixbuf) / sizeof(*px_dest)) - width;
+
+	switch (img->format()) {
+		case rp_image::FORMAT_ARGB32: {
+			// Copy the image data.
+			const uint32_t *img_buf = static_cast<const uint32_t*>(img->bits());
+			const int src_stride_adj = (img->stride() / sizeof(uint32_t)) - width;
+			for (unsigned int y = (unsigned int)height; y > 0; y--) {
+				// Process 16 pixels per iteration using NEON.
+				// VLD4 deinterleaves the B/G/R/A channels into
+				// separate registers; swapping the B and R
+				// registers before VST4 swaps the channels.
+				unsigned int x = (unsigned int)width;
+				for (; x > 15; x -= 16, px_dest += 16, img_buf += 16) {
+					uint8x16x4_t bgra = vld4q_u8(reinterpret_cast<const uint8_t*>(img_buf));
+					const uint8x16_t tmp = bgra.val[0];
+					bgra.val[0] = bgra.val[2];
+					bgra.val[2] = tmp;
+					vst4q_u8(reinterpret_cast<uint8_t*>(px_dest), bgra);
+				}
+
+				// Remaining pixels.
+				for (; x > 0; x--) {
+					// Last pixel.
+					*px_dest = (*img_buf & 0xFF00FF00) |
+						  ((*img_buf & 0x00FF0000) >> 16) |
+						  ((*img_buf & 0x000000FF) << 16);
+					img_buf++;
+					px_dest++;
+				}
+
+				// Next line.
+				img_buf += src_stride_adj;
+				px_dest += dest_stride_adj;
+			}
+			break;
+		}
+
+		case rp_image::FORMAT_CI8: {
+			// Get the R/B-swapped palette. (cached in rp_image)
+			const uint32_t *palette = img->palette_bswapped();
+			assert(palette != nullptr);
+			if (unlikely(!palette))
+				break;
+
+			// Convert the image data from CI8 to ARGB32.
+			const uint8_t *img_buf = static_cast<const uint8_t*>(img->bits());
+			const int src_stride_adj = img->stride() - width;
+			for (unsigned int y = (unsigned int)height; y > 0; y--) {
+				unsigned int x;
+				for (x = (unsigned int)width; x > 3; x -= 4) {
+					px_dest[0] = palette[img_buf[0]];
+					px_dest[1] = palette[img_buf[1]];
+					px_dest[2] = palette[img_buf[2]];
+					px_dest[3] = palette[img_buf[3]];
+					px_dest += 4;
+					img_buf += 4;
+				}
+				for (; x > 0; x--, px_dest++, img_buf++) {
+					// Last pixels.
+					*px_dest = palette[*img_buf];
+				}
+
+				// Next line.
+				img_buf += src_stride_adj;
+				px_dest += dest_stride_adj;
+			}
+			break;
+		}
+
+		default:
+			// Unsupported image format.
+			assert(!"Unsupported rp_image::Format.");
+			g_object_unref(pixbuf);
+			pixbuf = nullptr;
+			break;
+	}
+
+	return pixbuf;
+}
+
+#endif /* GDKIMAGECONV_HAS_NEON */
@@ -25,6 +25,33 @@ using LibRpBase::rp_image;
 #include <emmintrin.h>
 #include <tmmintrin.h>
 
+// Non-temporal store threshold.
+// For images larger than this, bypass the cache on stores:
+// the destination is consumed by GTK/X, not re-read by the CPU,
+// so there's no point in polluting L2/L3 with the writebacks.
+static const size_t NT_THRESHOLD = 256U*1024U;
+
+// Cache tile size, in pixels.
+// Contiguous images are converted in tiles of this many pixels so
+// each tile's source data (~256 KiB) stays L2-resident while the
+// (often non-temporal) stores stream to the destination.
+static const unsigned int TILE_PX = (unsigned int)(NT_THRESHOLD / sizeof(uint32_t));
+
+/**
+ * Store a 128-bit value, optionally using a non-temporal store.
+ * @param p	[out] Destination. (must be 16-byte aligned)
+ * @param v	[in] Value.
+ * @param nt	[in] If true, use a non-temporal store.
+ */
+static FORCEINLINE void rp_store_si128(__m128i *p, __m128i v, bool nt)
+{
+	if (nt) {
+		_mm_stream_si128(p, v);
+	} else {
+		_mm_store_si128(p, v);
+	}
+}
+
 /**
  * GdkPixbufDestroyNotify() callback.
  * @param pixels Pixel data.
@@ -75,6 +102,9 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 	assert(gdk_pixbuf_get_rowstride(pixbuf) == rowstride);
 	const int dest_stride_adj = (rowstride / sizeof(*px_dest)) - img->width();
 
+	// Use non-temporal stores for large images.
+	const bool use_nt = ((size_t)width * (size_t)height * sizeof(uint32_t)) > NT_THRESHOLD;
+
 	// ABGR shuffle mask.
 	const __m128i shuf_mask = _mm_setr_epi8(2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
 
@@ -83,9 +113,26 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 			// Copy the image data.
 			const uint32_t *img_buf = static_cast<const uint32_t*>(img->bits());
 			const int src_stride_adj = (img->stride() / sizeof(uint32_t)) - width;
-			for (unsigned int y = (unsigned int)height; y > 0; y--) {
+
+			// If both buffers are contiguous, fuse the rows and
+			// split the fused run into L2-sized tiles. Each tile's
+			// source footprint stays cache-resident while the
+			// stores stream to the destination.
+			unsigned int row_width = (unsigned int)width, rows = (unsigned int)height;
+			unsigned int px_remaining = 0;
+			if (src_stride_adj == 0 && dest_stride_adj == 0) {
+				px_remaining = (unsigned int)(width * height);
+				rows = (px_remaining + TILE_PX - 1) / TILE_PX;
+			}
+
+			for (unsigned int y = rows; y > 0; y--) {
 				// Process 16 pixels per iteration using SSSE3.
-				unsigned int x = (unsigned int)width;
+				unsigned int x = row_width;
+				if (px_remaining != 0) {
+					// Contiguous: next L2-sized tile.
+					x = (px_remaining > TILE_PX ? TILE_PX : px_remaining);
+					px_remaining -= x;
+				}
 				for (; x > 15; x -= 16, px_dest += 16, img_buf += 16) {
 					const __m128i *xmm_src = reinterpret_cast<const __m128i*>(img_buf);
 					__m128i *xmm_dest = reinterpret_cast<__m128i*>(px_dest);
@@ -96,16 +143,16 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 					__m128i sd = _mm_load_si128(&xmm_src[3]);
 
 					__m128i val = _mm_shuffle_epi8(sa, shuf_mask);
-					_mm_store_si128(&xmm_dest[0], val);
+					rp_store_si128(&xmm_dest[0], val, use_nt);
 
 					val = _mm_shuffle_epi8(sb, shuf_mask);
-					_mm_store_si128(&xmm_dest[1], val);
+					rp_store_si128(&xmm_dest[1], val, use_nt);
 
 					val = _mm_shuffle_epi8(sc, shuf_mask);
-					_mm_store_si128(&xmm_dest[2], val);
+					rp_store_si128(&xmm_dest[2], val, use_nt);
 
 					val = _mm_shuffle_epi8(sd, shuf_mask);
-					_mm_store_si128(&xmm_dest[3], val);
+					rp_store_si128(&xmm_dest[3], val, use_nt);
 				}
 
 				// Remaining pixels.
@@ -126,60 +173,11 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 		}
 
 		case rp_image::FORMAT_CI8: {
-			const uint32_t *src_pal = img->palette();
-			const int src_pal_len = img->palette_len();
-			assert(src_pal != nullptr);
-			assert(src_pal_len > 0);
-			if (!src_pal || src_pal_len <= 0)
-				break;
-
-			// Get the palette.
-			static const int dest_pal_len = 256;
-			uint32_t *const palette = static_cast<uint32_t*>(aligned_malloc(16, dest_pal_len*sizeof(uint32_t)));
+			// Get the R/B-swapped palette. (cached in rp_image)
+			const uint32_t *palette = img->palette_bswapped();
 			assert(palette != nullptr);
-			if (unlikely(!palette)) {
-				// Unable to allocate memory for the palette.
-				g_object_unref(G_OBJECT(pixbuf));
-				return nullptr;
-			}
-
-			// Process 16 colors per iteration using SSSE3.
-			unsigned int i = (unsigned int)src_pal_len;
-			uint32_t *dest_pal = palette;
-			for (; i > 15; i -= 16, dest_pal += 16, src_pal += 16) {
-				const __m128i *xmm_src = reinterpret_cast<const __m128i*>(src_pal);
-				__m128i *xmm_dest = reinterpret_cast<__m128i*>(dest_pal);
-
-				__m128i sa = _mm_load_si128(&xmm_src[0]);
-				__m128i sb = _mm_load_si128(&xmm_src[1]);
-				__m128i sc = _mm_load_si128(&xmm_src[2]);
-				__m128i sd = _mm_load_si128(&xmm_src[3]);
-
-				__m128i val = _mm_shuffle_epi8(sa, shuf_mask);
-				_mm_store_si128(&xmm_dest[0], val);
-
-				val = _mm_shuffle_epi8(sb, shuf_mask);
-				_mm_store_si128(&xmm_dest[1], val);
-
-				val = _mm_shuffle_epi8(sc, shuf_mask);
-				_mm_store_si128(&xmm_dest[2], val);
-
-				val = _mm_shuffle_epi8(sd, shuf_mask);
-				_mm_store_si128(&xmm_dest[3], val);
-			}
-
-			// Remaining colors.
-			for (; i > 0; i--, dest_pal++, src_pal++) {
-				*dest_pal = (*src_pal & 0xFF00FF00) |
-					   ((*src_pal & 0x00FF0000) >> 16) |
-					   ((*src_pal & 0x000000FF) << 16);
-			}
-
-			// Zero out the rest of the palette if the new
-			// palette is larger than the old palette.
-			if (src_pal_len < dest_pal_len) {
-				memset(dest_pal, 0, (dest_pal_len - src_pal_len) * sizeof(uint32_t));
-			}
+			if (unlikely(!palette))
+				break;
 
 			// Convert the image data from CI8 to ARGB32.
 			const uint8_t *img_buf = static_cast<const uint8_t*>(img->bits());
@@ -197,8 +195,6 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 				for (; x > 0; x--, px_dest++, img_buf++) {
 					// Last pixels.
 					*px_dest = palette[*img_buf];
-					px_dest++;
-					img_buf++;
 				}
 
 				// Next line.
@@ -206,7 +202,6 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 				px_dest += dest_stride_adj;
 			}
 
-			aligned_free(palette);
 			break;
 		}
 
@@ -218,5 +213,10 @@ GdkPixbuf *GdkImageConv::rp_image_to_GdkPixbuf_ssse3(const rp_image *img)
 			break;
 	}
 
+	if (use_nt) {
+		// Flush the write-combining buffers.
+		_mm_sfence();
+	}
+
 	return pixbuf;
 }
@@ -64,6 +64,21 @@ static inline void gtk_image_set_from_PIMGTYPE(GtkImage *image, PIMGTYPE pImgTyp
 #endif /* RP_GTK_USE_CAIRO */
 }
 
+/**
+ * Store a PIMGTYPE in a GValue.
+ * The GValue must have been initialized as PIMGTYPE_GOBJECT_TYPE.
+ * @param value GValue.
+ * @param pImgType PIMGTYPE.
+ */
+static inline void g_value_set_PIMGTYPE(GValue *value, PIMGTYPE pImgType)
+{
+#ifdef RP_GTK_USE_CAIRO
+	g_value_set_boxed(value, pImgType);
+#else /* !RP_GTK_USE_CAIRO */
+	g_value_set_object(value, pImgType);
+#endif /* RP_GTK_USE_CAIRO */
+}
+
 // PIMGTYPE free() wrapper function.
 static inline void PIMGTYPE_destroy(PIMGTYPE pImgType)
 {
@@ -9,6 +9,9 @@
 #include "RomDataView.hpp"
 #include "rp-gtk-enums.h"
 
+// GIO is used for GTask-based asynchronous ROM loading.
+#include <gio/gio.h>
+
 // librpbase
 #include "librpbase/common.h"
 #include "librpbase/TextFuncs.hpp"
@@ -27,13 +30,22 @@ using namespace LibRpBase;
 #include "libromdata/RomDataFactory.hpp"
 using LibRomData::RomDataFactory;
 
+// C includes.
+#include <langinfo.h>
 // C includes. (C++ namespace)
 #include <cassert>
+#include <cstring>
 
 // C++ includes.
+#include <array>
+#include <new>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+using std::pair;
 using std::string;
+using std::unordered_map;
 using std::vector;
 
 // PIMGTYPE
@@ -90,6 +102,7 @@ static void	rom_data_view_desc_format_type_changed(RpDescFormatType desc_format_
 						 RomDataView	*page);
 
 static void	rom_data_view_init_header_row	(RomDataView	*page);
+static gboolean	rom_data_view_convert_icon_frames(gpointer	 data);
 static void	rom_data_view_update_display	(RomDataView	*page);
 static gboolean	rom_data_view_load_rom_data	(gpointer	 data);
 static void	rom_data_view_delete_tabs	(RomDataView	*page);
@@ -129,6 +142,11 @@ struct _RomDataView {
 	/* Timeouts */
 	guint		changed_idle;
 
+	// In-flight ROM load task cancellable.
+	// Cancelled in dispose() so the completion callback
+	// doesn't touch widgets that have been destroyed.
+	GCancellable	*loadCancellable;
+
 	// Header row.
 	GtkWidget	*hboxHeaderRow;
 	GtkWidget	*lblSysInfo;
@@ -142,8 +160,11 @@ struct _RomDataView {
 	RomData		*romData;
 
 	// Animated icon data.
-	// TODO: Use std::array<>?
-	PIMGTYPE	iconFrames[IconAnimData::MAX_FRAMES];
+	// NOTE: Allocated by g_object_new(), so the array is
+	// zero-initialized, not default-constructed.
+	std::array<PIMGTYPE, IconAnimData::MAX_FRAMES> iconFrames;
+	int		iconFrameCount;		// Number of valid frames.
+	guint		iconFrames_idle;	// Deferred frame conversion idle source.
 	IconAnimHelper	*iconAnimHelper;
 	int		last_frame_number;	// Last frame number.
 
@@ -158,11 +179,32 @@ struct _RomDataView {
 		GtkWidget	*table;		// GtkTable (2.x); GtkGrid (3.x)
 		GtkWidget	*lblCredits;
 	};
-	vector<tab> *tabs;
 
-	// Description labels.
+	// C++ containers.
+	// NOTE: Stored inline instead of as heap pointers to avoid
+	// three allocations per page. The instance struct is allocated
+	// by g_object_new(), so these are constructed with placement
+	// new in init() and destroyed explicitly in finalize().
+	vector<tab>	tabs;
+
+	// Description labels, with their "warning" formatting flags.
+	// Storing the flag here avoids a GObject data hash lookup
+	// per label when the description format type changes.
 	RpDescFormatType		desc_format_type;
-	vector<GtkWidget*>		*vecDescLabels;
+	vector<pair<GtkLabel*, bool> >	vecDescLabels;
+
+	// rp_image -> PIMGTYPE conversion cache.
+	// The ROM parsers often share rp_image objects between the
+	// header row and list data fields, so each unique image is
+	// only converted once per load. The cached PIMGTYPEs are owned
+	// by the cache; the rp_image keys are owned by romData, so the
+	// cache is cleared in rom_data_view_delete_tabs().
+	unordered_map<const rp_image*, PIMGTYPE> imgCache;
+
+	// Shared "toggled" closure for RFT_BITFIELD checkboxes.
+	// One closure is reused for every checkbox on the page instead
+	// of allocating a new GClosure per g_signal_connect() call.
+	GClosure	*checkboxClosure;
 };
 
 // FIXME: G_DEFINE_TYPE() doesn't work in C++ mode with gcc-6.2
@@ -179,6 +221,11 @@ G_DEFINE_TYPE_EXTENDED(RomDataView, rom_data_view,
 
 static GParamSpec *properties[PROP_LAST];
 
+// GQuark for the value stored in each RFT_BITFIELD checkbox.
+// Precomputing the quark avoids a string hash + lookup for
+// every g_object_set_data() call in init_bitfield().
+static GQuark RFT_BITFIELD_value_quark;
+
 static void
 rom_data_view_class_init(RomDataViewClass *klass)
 {
@@ -213,6 +260,9 @@ rom_data_view_class_init(RomDataViewClass *klass)
 	// Install the properties.
 	g_object_class_install_property(gobject_class, PROP_FILENAME, properties[PROP_FILENAME]);
 	g_object_class_install_property(gobject_class, PROP_DESC_FORMAT_TYPE, properties[PROP_DESC_FORMAT_TYPE]);
+
+	// Initialize the GQuark for RFT_BITFIELD checkbox values.
+	RFT_BITFIELD_value_quark = g_quark_from_static_string("RFT_BITFIELD_value");
 }
 
 /**
@@ -220,76 +270,79 @@ rom_data_view_class_init(RomDataViewClass *klass)
  * @param page RomDataView.
  * @param label GtkLabel.
  * @param desc_format_type Format type.
+ * @param is_warning If true, use the "warning" format.
  */
 static inline void
-set_label_format_type(GtkLabel *label, RpDescFormatType desc_format_type)
+set_label_format_type(GtkLabel *label, RpDescFormatType desc_format_type, gboolean is_warning)
 {
-	PangoAttrList *attr_lst = pango_attr_list_new();
+	// Cached PangoAttrLists, indexed by [desc_format_type][is_warning].
+	// PangoAttrLists are immutable once set on a label, so the same
+	// list can be shared by all description labels. This avoids
+	// rebuilding identical lists when retheming iterates over every
+	// label in vecDescLabels.
+	static PangoAttrList *attr_lst_cache[RP_DFT_LAST][2] = {{nullptr, nullptr}};
+	static gsize attr_lst_once = 0;
+	if (g_once_init_enter(&attr_lst_once)) {
+		// XFCE, normal: Bold.
+		PangoAttrList *attr_lst = pango_attr_list_new();
+		pango_attr_list_insert(attr_lst,
+			pango_attr_weight_new(PANGO_WEIGHT_BOLD));
+		attr_lst_cache[RP_DFT_XFCE][0] = attr_lst;
 
-	// Check if this label has the "Warning" flag set.
-	const gboolean is_warning = (gboolean)GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(label), "RFT_STRING_warning"));
-	if (is_warning) {
-		// Use the "Warning" format.
+		// Warning (both styles): Bold, red foreground.
+		attr_lst = pango_attr_list_new();
 		pango_attr_list_insert(attr_lst,
 			pango_attr_weight_new(PANGO_WEIGHT_BOLD));
 		pango_attr_list_insert(attr_lst,
 			pango_attr_foreground_new(65535, 0, 0));
-	}
+		attr_lst_cache[RP_DFT_XFCE][1] = attr_lst;
+		attr_lst_cache[RP_DFT_GNOME][1] = pango_attr_list_ref(attr_lst);
 
-	// Check for DE-specific formatting.
-	switch (desc_format_type) {
-		case RP_DFT_XFCE:
-		default:
-			// XFCE style.
-			// NOTE: No changes between GTK+ 2.x and 3.x.
+		// GNOME, normal: No attributes.
+		attr_lst_cache[RP_DFT_GNOME][0] = pango_attr_list_new();
 
-			// Text alignment: Right
-			gtk_label_set_justify(label, GTK_JUSTIFY_RIGHT);
-#if GTK_CHECK_VERSION(3,16,0)
-			// NOTE: gtk_widget_set_?align() doesn't work properly
-			// when using a GtkSizeGroup on GTK+ 3.x.
-			// gtk_label_set_?align() was introduced in GTK+ 3.16.
-			gtk_label_set_xalign(label, 1.0);
-			gtk_label_set_yalign(label, 0.0);
-#else
-			// NOTE: GtkMisc is deprecated on GTK+ 3.x, but it's
-			// needed for proper text alignment when using
-			// GtkSizeGroup prior to GTK+ 3.16.
-			gtk_misc_set_alignment(GTK_MISC(label), 1.0f, 0.0f);
-#endif
+		g_once_init_leave(&attr_lst_once, 1);
+	}
 
-			if (!is_warning) {
-				// Text style: Bold
-				pango_attr_list_insert(attr_lst,
-					pango_attr_weight_new(PANGO_WEIGHT_BOLD));
-			}
-			break;
+	// DE-specific label formatting, indexed by RpDescFormatType.
+	// Using a table instead of a switch keeps this straight-line code
+	// and makes it trivial to add more DE styles later.
+	// NOTE: Text style (bold/warning) is handled by attr_lst_cache[].
+	struct LabelFmt {
+		GtkJustification justify;
+		float xalign, yalign;
+	};
+	static const LabelFmt lblFmt_tbl[RP_DFT_LAST] = {
+		// RP_DFT_XFCE: Right-aligned, bold.
+		// NOTE: No changes between GTK+ 2.x and 3.x.
+		{GTK_JUSTIFY_RIGHT, 1.0f, 0.0f},
+		// RP_DFT_GNOME: Left-aligned, normal. (Also used for MATE.)
+		// TODO: Changes for GNOME 2.
+		{GTK_JUSTIFY_LEFT, 0.0f, 0.0f},
+	};
 
-		case RP_DFT_GNOME:
-			// GNOME style. (Also used for MATE.)
-			// TODO: Changes for GNOME 2.
+	RpDescFormatType dft = desc_format_type;
+	if ((int)dft < RP_DFT_XFCE || (int)dft >= RP_DFT_LAST) {
+		// Invalid format type. Use the XFCE style.
+		dft = RP_DFT_XFCE;
+	}
 
-			// Text alignment: Left
-			gtk_label_set_justify(label, GTK_JUSTIFY_LEFT);
+	const LabelFmt &fmt = lblFmt_tbl[dft];
+	gtk_label_set_justify(label, fmt.justify);
 #if GTK_CHECK_VERSION(3,16,0)
-			// NOTE: gtk_widget_set_?align() doesn't work properly
-			// when using a GtkSizeGroup on GTK+ 3.x.
-			// gtk_label_set_?align() was introduced in GTK+ 3.16.
-			gtk_label_set_xalign(label, 0.0);
-			gtk_label_set_yalign(label, 0.0);
+	// NOTE: gtk_widget_set_?align() doesn't work properly
+	// when using a GtkSizeGroup on GTK+ 3.x.
+	// gtk_label_set_?align() was introduced in GTK+ 3.16.
+	gtk_label_set_xalign(label, fmt.xalign);
+	gtk_label_set_yalign(label, fmt.yalign);
 #else
-			// NOTE: GtkMisc is deprecated on GTK+ 3.x, but it's
-			// needed for proper text alignment when using
-			// GtkSizeGroup prior to GTK+ 3.16.
-			gtk_misc_set_alignment(GTK_MISC(label), 0.0f, 0.0f);
+	// NOTE: GtkMisc is deprecated on GTK+ 3.x, but it's
+	// needed for proper text alignment when using
+	// GtkSizeGroup prior to GTK+ 3.16.
+	gtk_misc_set_alignment(GTK_MISC(label), fmt.xalign, fmt.yalign);
 #endif
 
-			// Text style: Normal (no Pango attributes)
-			break;
-	}
-
-	gtk_label_set_attributes(label, attr_lst);
-	pango_attr_list_unref(attr_lst);
+	gtk_label_set_attributes(label, attr_lst_cache[dft][is_warning ? 1 : 0]);
 }
 
 static void
@@ -298,13 +351,29 @@ rom_data_view_init(RomDataView *page)
 	// No ROM data initially.
 	page->filename = nullptr;
 	page->romData = nullptr;
+	page->iconFrameCount = 0;
+	page->iconFrames_idle = 0;
 	page->last_frame_number = 0;
 	page->iconAnimHelper = new IconAnimHelper();
 	page->tabWidget = nullptr;
-	page->tabs = new vector<RomDataView::tab>();
-
 	page->desc_format_type = RP_DFT_XFCE;
-	page->vecDescLabels = new vector<GtkWidget*>();
+
+	// Construct the inline C++ containers.
+	// NOTE: The instance struct is allocated by g_object_new(),
+	// which doesn't run C++ constructors, so placement new is
+	// needed here. They're destroyed explicitly in finalize().
+	new(&page->tabs) vector<RomDataView::tab>();
+	new(&page->vecDescLabels) vector<pair<GtkLabel*, bool> >();
+	new(&page->imgCache) unordered_map<const rp_image*, PIMGTYPE>();
+
+	// Shared "toggled" closure for RFT_BITFIELD checkboxes.
+	// ref_sink() converts the closure's initial floating reference
+	// into a real one owned by the page; it's released in finalize().
+	page->checkboxClosure = g_cclosure_new(
+		reinterpret_cast<GCallback>(checkbox_no_toggle_signal_handler),
+		page, nullptr);
+	g_closure_ref(page->checkboxClosure);
+	g_closure_sink(page->checkboxClosure);
 
 	// Animation timer.
 	page->tmrIconAnim = 0;
@@ -382,6 +451,16 @@ rom_data_view_dispose(GObject *object)
 		page->changed_idle = 0;
 	}
 
+	// Cancel any in-flight ROM load task. The completion
+	// callback may still run after dispose() (the task holds
+	// its own reference on the page), so it has to be told
+	// not to touch the destroyed widgets.
+	if (page->loadCancellable) {
+		g_cancellable_cancel(page->loadCancellable);
+		g_object_unref(page->loadCancellable);
+		page->loadCancellable = nullptr;
+	}
+
 	// Delete the animation timer.
 	if (page->tmrIconAnim > 0) {
 		g_source_remove(page->tmrIconAnim);
@@ -404,9 +483,18 @@ rom_data_view_finalize(GObject *object)
 	g_free(page->filename);
 
 	// Delete the C++ objects.
+	// NOTE: imgCache entries were destroyed by
+	// rom_data_view_delete_tabs() in dispose().
 	delete page->iconAnimHelper;
-	delete page->tabs;
-	delete page->vecDescLabels;
+
+	// Destroy the inline C++ containers.
+	// (Constructed with placement new in init().)
+	page->tabs.~vector();
+	page->vecDescLabels.~vector();
+	page->imgCache.~unordered_map();
+
+	// Release the shared checkbox closure.
+	g_closure_unref(page->checkboxClosure);
 
 	// Unreference romData.
 	if (page->romData) {
@@ -503,19 +591,13 @@ rom_data_view_set_filename(RomDataView	*page,
 		return;
 
 	/* Disconnect from the previous file (if any) */
-	if (G_LIKELY(page->filename != nullptr)) {
-		g_free(page->filename);
-		page->filename = nullptr;
-
-		// Unreference the existing RomData object.
-		if (page->romData) {
-			page->romData->unref();
-			page->romData = nullptr;
-		}
-
-		// Delete the icon frames and tabs.
-		rom_data_view_delete_tabs(page);
-	}
+	// NOTE: The old RomData object and tabs are NOT torn down here.
+	// Teardown is deferred to rom_data_view_load_rom_data(), so a
+	// rapid series of set_filename() calls (e.g. scrubbing through a
+	// selection in the file manager) only tears down and re-parses
+	// once, when the pending idle callback actually fires.
+	g_free(page->filename);
+	page->filename = nullptr;
 
 	/* Assign the value */
 	page->filename = g_strdup(filename);
@@ -524,6 +606,13 @@ rom_data_view_set_filename(RomDataView	*page,
 	if (G_LIKELY(page->filename != nullptr)) {
 		rom_data_view_filename_changed(page->filename, page);
 	} else {
+		// No filename. Tear down the display immediately.
+		if (page->romData) {
+			page->romData->unref();
+			page->romData = nullptr;
+		}
+		rom_data_view_delete_tabs(page);
+
 		// Hide the header row
 		if (page->hboxHeaderRow) {
 			gtk_widget_hide(page->hboxHeaderRow);
@@ -578,13 +667,37 @@ rom_data_view_desc_format_type_changed(RpDescFormatType	desc_format_type,
 	g_return_if_fail(IS_ROM_DATA_VIEW(page));
 	g_return_if_fail(desc_format_type >= RP_DFT_XFCE && desc_format_type < RP_DFT_LAST);
 
-	for (auto iter = page->vecDescLabels->cbegin();
-	     iter != page->vecDescLabels->cend(); ++iter)
-	{
-		set_label_format_type(GTK_LABEL(*iter), desc_format_type);
+	// The hot part of this loop is a contiguous walk over the
+	// (label, is_warning) pairs; the attr lists are cached in
+	// set_label_format_type().
+	for (const auto &lbl : page->vecDescLabels) {
+		set_label_format_type(lbl.first, desc_format_type, lbl.second);
 	}
 }
 
+/**
+ * Convert an rp_image to PIMGTYPE, with per-page caching.
+ * The returned PIMGTYPE is owned by the page's image cache and is
+ * valid until the ROM data is unloaded. Do NOT destroy it.
+ * @param page	[in] RomDataView object.
+ * @param img	[in] rp_image.
+ * @return PIMGTYPE, or nullptr on error.
+ */
+static PIMGTYPE
+rp_image_to_PIMGTYPE_cached(RomDataView *page, const rp_image *img)
+{
+	auto iter = page->imgCache.find(img);
+	if (iter != page->imgCache.end()) {
+		// Image was already converted.
+		return iter->second;
+	}
+
+	PIMGTYPE pImgType = rp_image_to_PIMGTYPE(img);
+	// Cache the result, even if conversion failed.
+	page->imgCache.emplace(img, pImgType);
+	return pImgType;
+}
+
 static void
 rom_data_view_init_header_row(RomDataView *page)
 {
@@ -614,10 +727,15 @@ rom_data_view_init_header_row(RomDataView *page)
 		fileType = C_("RomDataView", "(unknown filetype)");
 	}
 
-	const string sysInfo = rp_sprintf_p(
+	// NOTE: Using g_snprintf() with a stack buffer instead of
+	// rp_sprintf_p() to avoid two heap allocations for a tiny string.
+	// Positional format specifiers are POSIX, which is fine here,
+	// since the GTK+ frontends are only built on Unix-like systems.
+	char sysInfo[256];
+	g_snprintf(sysInfo, sizeof(sysInfo),
 		// tr: %1$s == system name, %2$s == file type
 		C_("RomDataView", "%1$s\n%2$s"), systemName, fileType);
-	gtk_label_set_text(GTK_LABEL(page->lblSysInfo), sysInfo.c_str());
+	gtk_label_set_text(GTK_LABEL(page->lblSysInfo), sysInfo);
 
 	// Supported image types.
 	const uint32_t imgbf = page->romData->supportedImageTypes();
@@ -628,10 +746,10 @@ rom_data_view_init_header_row(RomDataView *page)
 		// Get the banner.
 		const rp_image *banner = page->romData->image(RomData::IMG_INT_BANNER);
 		if (banner && banner->isValid()) {
-			PIMGTYPE pImgType = rp_image_to_PIMGTYPE(banner);
+			// NOTE: The converted banner is owned by the image cache.
+			PIMGTYPE pImgType = rp_image_to_PIMGTYPE_cached(page, banner);
 			if (pImgType) {
 				gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgBanner), pImgType);
-				PIMGTYPE_destroy(pImgType);
 				gtk_widget_show(page->imgBanner);
 			}
 		}
@@ -646,35 +764,51 @@ rom_data_view_init_header_row(RomDataView *page)
 			// Is this an animated icon?
 			const IconAnimData *const iconAnimData = page->romData->iconAnimData();
 			if (iconAnimData) {
-				// Convert the icons to PIMGTYPE.
-				for (int i = iconAnimData->count-1; i >= 0; i--) {
-					const rp_image *const frame = iconAnimData->frames[i];
-					if (frame && frame->isValid()) {
-						PIMGTYPE pImgType = rp_image_to_PIMGTYPE(frame);
-						if (pImgType) {
-							page->iconFrames[i] = pImgType;
-						}
-					}
-				}
+				page->iconFrameCount = iconAnimData->count;
 
 				// Set up the IconAnimHelper.
 				page->iconAnimHelper->setIconAnimData(iconAnimData);
 				// Initialize the animation.
 				page->last_frame_number = page->iconAnimHelper->frameNumber();
 
-				// Show the first frame.
-				gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgIcon),
-					page->iconFrames[page->last_frame_number]);
-				gtk_widget_show(page->imgIcon);
+				// Convert only the first-paint frame synchronously.
+				// The remaining frames are converted by a
+				// low-priority idle callback: only the displayed
+				// frame is needed before first paint, and the
+				// animation timer won't need another frame for
+				// at least one frame delay.
+				const rp_image *const frame =
+					iconAnimData->frames[page->last_frame_number];
+				if (frame && frame->isValid()) {
+					// NOTE: Frames are owned by the image cache.
+					page->iconFrames[page->last_frame_number] =
+						rp_image_to_PIMGTYPE_cached(page, frame);
+				}
+
+				if (page->iconFrames[page->last_frame_number]) {
+					// Show the first frame.
+					gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgIcon),
+						page->iconFrames[page->last_frame_number]);
+					gtk_widget_show(page->imgIcon);
+				}
+
+				// Convert the remaining frames when idle.
+				if (page->iconFrames_idle == 0) {
+					page->iconFrames_idle = g_idle_add_full(
+						G_PRIORITY_DEFAULT_IDLE,
+						rom_data_view_convert_icon_frames,
+						page, nullptr);
+				}
 
 				// Icon animation timer is set in start_anim_timer().
 			} else {
 				// Not an animated icon.
 				page->last_frame_number = 0;
-				PIMGTYPE pImgType = rp_image_to_PIMGTYPE(icon);
+				PIMGTYPE pImgType = rp_image_to_PIMGTYPE_cached(page, icon);
 				if (pImgType) {
 					gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgIcon), pImgType);
 					page->iconFrames[0] = pImgType;
+					page->iconFrameCount = 1;
 					gtk_widget_show(page->imgIcon);
 				}
 			}
@@ -685,6 +819,47 @@ rom_data_view_init_header_row(RomDataView *page)
 	gtk_widget_show(page->hboxHeaderRow);
 }
 
+/**
+ * Convert the remaining animated icon frames.
+ * Scheduled as a low-priority idle callback by init_header_row() so
+ * that only the displayed frame's conversion delays the first paint.
+ * @param data RomDataView*.
+ * @return FALSE to remove the idle source.
+ */
+static gboolean
+rom_data_view_convert_icon_frames(gpointer data)
+{
+	RomDataView *const page = ROM_DATA_VIEW(data);
+	page->iconFrames_idle = 0;
+
+	// NOTE: The idle source is removed when the ROM data is
+	// unloaded, so iconAnimData is still valid here.
+	if (!page->romData) {
+		return false;
+	}
+	const IconAnimData *const iconAnimData = page->romData->iconAnimData();
+	if (!iconAnimData) {
+		return false;
+	}
+
+	// Convert the frames that weren't converted for first paint.
+	// (Forward iteration for HW prefetch.)
+	for (int i = 0; i < iconAnimData->count; i++) {
+		if (page->iconFrames[i]) {
+			// Already converted.
+			continue;
+		}
+		const rp_image *const frame = iconAnimData->frames[i];
+		if (frame && frame->isValid()) {
+			// NOTE: Frames are owned by the image cache.
+			// Animations frequently reuse frames, so
+			// duplicates are only converted once.
+			page->iconFrames[i] = rp_image_to_PIMGTYPE_cached(page, frame);
+		}
+	}
+	return false;
+}
+
 #if GTK_CHECK_VERSION(3,0,0)
 #define GTK_WIDGET_HALIGN_LEFT(widget)		gtk_widget_set_halign((widget), GTK_ALIGN_START)
 #define GTK_WIDGET_HALIGN_CENTER(widget)	gtk_widget_set_halign((widget), GTK_ALIGN_CENTER)
@@ -737,29 +912,45 @@ rom_data_view_init_string(RomDataView *page, const RomFields::Field *field, cons
 
 	// Check for any formatting options. (RFT_STRING only)
 	if (field->type == RomFields::RFT_STRING && field->desc.flags != 0) {
-		PangoAttrList *const attr_lst = pango_attr_list_new();
+		// Only allocate an attribute list if a flag that actually
+		// needs Pango attributes is set. STRF_CREDITS formatting is
+		// embedded in the markup itself, so credits-only labels
+		// skip the allocation and the set_attributes() call, which
+		// would otherwise fight with the markup's own attributes.
+		if (field->desc.flags & (RomFields::STRF_MONOSPACE | RomFields::STRF_WARNING)) {
+			PangoAttrList *const attr_lst = pango_attr_list_new();
+
+			// Monospace font?
+			if (field->desc.flags & RomFields::STRF_MONOSPACE) {
+				// The family attribute is created once and copied
+				// per label, so the family string is only
+				// allocated and parsed on first use.
+				// NOTE: Only used on the GTK+ main thread.
+				static PangoAttribute *attr_mono = nullptr;
+				if (!attr_mono) {
+					attr_mono = pango_attr_family_new("monospace");
+				}
+				pango_attr_list_insert(attr_lst,
+					pango_attribute_copy(attr_mono));
+			}
 
-		// Monospace font?
-		if (field->desc.flags & RomFields::STRF_MONOSPACE) {
-			pango_attr_list_insert(attr_lst,
-				pango_attr_family_new("monospace"));
-		}
+			// "Warning" font?
+			if (field->desc.flags & RomFields::STRF_WARNING) {
+				pango_attr_list_insert(attr_lst,
+					pango_attr_weight_new(PANGO_WEIGHT_BOLD));
+				pango_attr_list_insert(attr_lst,
+					pango_attr_foreground_new(65535, 0, 0));
+			}
 
-		// "Warning" font?
-		if (field->desc.flags & RomFields::STRF_WARNING) {
-			pango_attr_list_insert(attr_lst,
-				pango_attr_weight_new(PANGO_WEIGHT_BOLD));
-			pango_attr_list_insert(attr_lst,
-				pango_attr_foreground_new(65535, 0, 0));
+			gtk_label_set_attributes(GTK_LABEL(widget), attr_lst);
+			pango_attr_list_unref(attr_lst);
 		}
 
-		gtk_label_set_attributes(GTK_LABEL(widget), attr_lst);
-		pango_attr_list_unref(attr_lst);
-
 		if (field->desc.flags & RomFields::STRF_CREDITS) {
 			// Credits row goes at the end.
 			// There should be a maximum of one STRF_CREDITS per tab.
-			auto &tab = page->tabs->at(field->tabIdx);
+			// NOTE: tabIdx was validated by the caller.
+			auto &tab = page->tabs[field->tabIdx];
 			assert(tab.lblCredits == nullptr);
 
 			// Credits row.
@@ -832,15 +1023,19 @@ rom_data_view_init_bitfield(RomDataView *page, const RomFields::Field *field)
 		gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(checkBox), value);
 
 		// Save the bitfield checkbox's value in the GObject.
-		g_object_set_data(G_OBJECT(checkBox), "RFT_BITFIELD_value", GUINT_TO_POINTER((guint)value));
+		// NOTE: Using the precomputed GQuark directly instead of
+		// g_object_set_data() to skip a string lookup per checkbox.
+		g_object_set_qdata(G_OBJECT(checkBox), RFT_BITFIELD_value_quark, GUINT_TO_POINTER((guint)value));
 
 		// Disable user modifications.
 		// NOTE: Unlike Qt, both the "clicked" and "toggled" signals are
 		// emitted for both user and program modifications, so we have to
 		// connect this signal *after* setting the initial value.
-		g_signal_connect(checkBox, "toggled",
-			reinterpret_cast<GCallback>(checkbox_no_toggle_signal_handler),
-			page);
+		// NOTE 2: Connecting the page's shared closure instead of using
+		// g_signal_connect(), which would allocate a new GClosure for
+		// every checkbox.
+		g_signal_connect_closure(checkBox, "toggled",
+			page->checkboxClosure, FALSE);
 
 #if GTK_CHECK_VERSION(3,0,0)
 		// TODO: GTK_FILL
@@ -859,6 +1054,39 @@ rom_data_view_init_bitfield(RomDataView *page, const RomFields::Field *field)
 	return widget;
 }
 
+/**
+ * Create the checkbox or icon column for an RFT_LISTDATA view.
+ * Both columns are identical except for the renderer, the bound
+ * attribute, and the fixed width, so one helper covers both.
+ * The column is not appended here; the caller batches the appends.
+ * @param checkbox	[in] If true, checkbox column; if false, icon column.
+ * @return GtkTreeViewColumn.
+ */
+static GtkTreeViewColumn*
+listdata_create_first_column(bool checkbox)
+{
+	GtkCellRenderer *renderer;
+	const char *attr;
+	int width;
+	if (checkbox) {
+		renderer = gtk_cell_renderer_toggle_new();
+		attr = "active";
+		width = 32;
+	} else {
+		renderer = gtk_cell_renderer_pixbuf_new();
+		attr = GTK_CELL_RENDERER_PIXBUF_PROPERTY;
+		// Icon size (32) plus cell padding.
+		width = 32 + 8;
+	}
+
+	GtkTreeViewColumn *const column = gtk_tree_view_column_new_with_attributes(
+		"", renderer, attr, 0, nullptr);
+	gtk_tree_view_column_set_resizable(column, true);
+	gtk_tree_view_column_set_sizing(column, GTK_TREE_VIEW_COLUMN_FIXED);
+	gtk_tree_view_column_set_fixed_width(column, width);
+	return column;
+}
+
 /**
  * Initialize a list data field.
  * @param page	[in] RomDataView object.
@@ -866,7 +1094,7 @@ rom_data_view_init_bitfield(RomDataView *page, const RomFields::Field *field)
  * @return Display widget, or nullptr on error.
  */
 static GtkWidget*
-rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Field *field)
+rom_data_view_init_listdata(RomDataView *page, const RomFields::Field *field)
 {
 	// ListData type. Create a GtkListStore for the data.
 	const auto &listDataDesc = field->desc.list_data;
@@ -905,94 +1133,173 @@ rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 		}
 	}
 
-	GtkListStore *listStore;
+	// Column types.
+	// Column counts are small, so use a stack array instead of
+	// heap-allocating one per listdata field.
+	GType types[64];
+	assert(col_count+1 <= (int)ARRAY_SIZE(types));
+	if (col_count+1 > (int)ARRAY_SIZE(types)) {
+		col_count = (int)ARRAY_SIZE(types)-1;
+	}
+
 	int col_start = 0;
 	if (hasCheckboxes) {
 		// Prepend an extra column for checkboxes.
-		GType *types = new GType[col_count+1];
 		types[0] = G_TYPE_BOOLEAN;
-		for (int i = col_count; i > 0; i--) {
-			types[i] = G_TYPE_STRING;
-		}
-		listStore = gtk_list_store_newv(col_count+1, types);
-		delete[] types;
 		col_start = 1;	// Skip the checkbox column for strings.
 	} else if (hasIcons) {
 		// Prepend an extra column for icons.
-		GType *types = new GType[col_count+1];
 		types[0] = PIMGTYPE_GOBJECT_TYPE;
-		for (int i = col_count; i > 0; i--) {
-			types[i] = G_TYPE_STRING;
-		}
-		listStore = gtk_list_store_newv(col_count+1, types);
-		delete[] types;
 		col_start = 1;	// Skip the icon column for strings.
-	} else {
-		// All strings.
-		GType *types = new GType[col_count];
-		for (int i = col_count-1; i >= 0; i--) {
-			types[i] = G_TYPE_STRING;
-		}
-		listStore = gtk_list_store_newv(col_count, types);
-		delete[] types;
 	}
+	for (int i = 0; i < col_count; i++) {
+		types[col_start+i] = G_TYPE_STRING;
+	}
+	GtkListStore *const listStore = gtk_list_store_newv(col_count+col_start, types);
 
 	// Add the row data.
+	// NOTE: The GtkListStore is populated *before* the GtkTreeView is
+	// created, so no view is attached yet and row-inserted handling is
+	// kept to a minimum. Freeze notifications for the duration of the
+	// population loop so property notify emissions are coalesced too.
+	g_object_freeze_notify(G_OBJECT(listStore));
 	if (list_data) {
 		uint32_t checkboxes = 0;
 		if (hasCheckboxes) {
 			checkboxes = field->data.list_data.mxd.checkboxes;
 		}
-		unsigned int row = 0;	// for icons [TODO: Use iterator?]
-		for (auto iter = list_data->cbegin(); iter != list_data->cend(); ++iter, row++) {
-			const vector<string> &data_row = *iter;
+
+		// Icon conversion cache. Rows frequently share icons, so
+		// convert and scale each unique rp_image only once.
+		// Base conversions are shared through the page's image
+		// cache; only scaled copies are owned (and destroyed) here.
+		// TODO: Ideal icon size? Using 32x32 for now.
+		static const int icon_sz = 32;
+		unordered_map<const rp_image*, PIMGTYPE> iconCache;
+		vector<PIMGTYPE> scaledIcons;
+		bool need_scale = false;
+		if (hasIcons) {
+			const auto *const icons = field->data.list_data.mxd.icons;
+			iconCache.reserve(icons->size());
+
+			// Determine the scaling decision up front. Icons usually
+			// come from a fixed-size spritesheet, so if every source
+			// image is already icon_sz, the per-row size checks and
+			// scaling can be skipped entirely.
+			for (const rp_image *icon : *icons) {
+				if (icon && (icon->width() != icon_sz ||
+				             icon->height() != icon_sz))
+				{
+					need_scale = true;
+					break;
+				}
+			}
+		}
+
+		// Column indexes and values for
+		// gtk_list_store_insert_with_valuesv(). The GValue types
+		// are initialized once; each row reuses the arrays.
+		// Inserting a row with all of its values in a single call
+		// emits one row-inserted signal per row, instead of one for
+		// insert_before() plus one per gtk_list_store_set() batch.
+		// Layout: slot 0 is the checkbox/icon column (if any);
+		// string columns follow at [col_start, total_cols).
+		const int total_cols = col_count + col_start;
+		gint cols[ARRAY_SIZE(types)];
+		GValue vals[ARRAY_SIZE(types)];
+		memset(vals, 0, sizeof(vals));
+		for (int i = 0; i < total_cols; i++) {
+			cols[i] = i;
+			g_value_init(&vals[i], types[i]);
+		}
+
+		// NOTE: Indexed loops instead of iterators here. The row
+		// index is needed for the icons vector anyway, and hoisting
+		// the size lets the compiler keep the loop bounds in
+		// registers.
+		const size_t row_count = list_data->size();
+		for (size_t row = 0; row < row_count; row++) {
+			const vector<string> &data_row = (*list_data)[row];
 			// FIXME: Skip even if we don't have checkboxes?
 			// (also check other UI frontends)
-			if (hasCheckboxes && data_row.empty()) {
+			if (hasCheckboxes && G_UNLIKELY(data_row.empty())) {
 				// Skip this row.
 				checkboxes >>= 1;
 				continue;
 			}
 
-			GtkTreeIter treeIter;
-			gtk_list_store_insert_before(listStore, &treeIter, nullptr);
+			// First valid slot. If an icon is missing, slot 0 is
+			// skipped by passing the arrays offset by col_start.
+			int first_val = col_start;
 			if (hasCheckboxes) {
 				// Checkbox column.
-				gtk_list_store_set(listStore, &treeIter,
-					0, (checkboxes & 1), -1);
+				g_value_set_boolean(&vals[0], (checkboxes & 1));
 				checkboxes >>= 1;
+				first_val = 0;
 			} else if (hasIcons) {
 				// Icon column.
-				PIMGTYPE pixbuf = rp_image_to_PIMGTYPE(
-					field->data.list_data.mxd.icons->at(row));
-				if (pixbuf) {
-					// TODO: Ideal icon size?
-					// Using 32x32 for now.
-					static const int icon_sz = 32;
-					// NOTE: GtkCellRendererPixbuf can't scale the
-					// pixbuf itself...
-					if (!PIMGTYPE_size_check(pixbuf, icon_sz, icon_sz)) {
-						// TODO: Use nearest-neighbor if upscaling.
-						// Also, preserve the aspect ratio.
-						PIMGTYPE scaled = PIMGTYPE_scale(pixbuf, icon_sz, icon_sz, true);
-						if (scaled) {
-							PIMGTYPE_destroy(pixbuf);
-							pixbuf = scaled;
+				const rp_image *const src = field->data.list_data.mxd.icons->at(row);
+				PIMGTYPE pixbuf;
+				auto iconIter = iconCache.find(src);
+				if (iconIter != iconCache.end()) {
+					// Icon was already converted.
+					pixbuf = iconIter->second;
+				} else {
+					pixbuf = rp_image_to_PIMGTYPE_cached(page, src);
+					if (pixbuf && need_scale) {
+						// NOTE: GtkCellRendererPixbuf can't scale the
+						// pixbuf itself...
+						if (!PIMGTYPE_size_check(pixbuf, icon_sz, icon_sz)) {
+							// TODO: Use nearest-neighbor if upscaling.
+							// Also, preserve the aspect ratio.
+							// NOTE: The unscaled original is owned by
+							// the page's image cache; only the scaled
+							// copy is destroyed here.
+							PIMGTYPE scaled = PIMGTYPE_scale(pixbuf, icon_sz, icon_sz, true);
+							if (scaled) {
+								scaledIcons.push_back(scaled);
+								pixbuf = scaled;
+							}
 						}
 					}
-					gtk_list_store_set(listStore, &treeIter,
-						0, pixbuf, -1);
-					PIMGTYPE_destroy(pixbuf);
+					// Cache the result, even if conversion failed.
+					iconCache.emplace(src, pixbuf);
+				}
+				if (pixbuf) {
+					g_value_set_PIMGTYPE(&vals[0], pixbuf);
+					first_val = 0;
 				}
 			}
 
-			int col = col_start;
-			for (auto iter = data_row.cbegin(); iter != data_row.cend(); ++iter, ++col) {
-				gtk_list_store_set(listStore, &treeIter,
-					col, iter->c_str(), -1);
+			// String columns.
+			// NOTE: Static strings, since the field data outlives
+			// the insert call. No copies are made for the GValues.
+			int str_count = (int)data_row.size();
+			if (str_count > col_count) {
+				str_count = col_count;
 			}
+			for (int i = 0; i < str_count; i++) {
+				g_value_set_static_string(&vals[col_start+i], data_row[i].c_str());
+			}
+
+			gtk_list_store_insert_with_valuesv(listStore, nullptr, -1,
+				&cols[first_val], &vals[first_val],
+				(col_start + str_count) - first_val);
+		}
+
+		// Unset the GValues.
+		// (Releases the last icon reference, if any.)
+		for (int i = 0; i < total_cols; i++) {
+			g_value_unset(&vals[i]);
+		}
+
+		// Destroy the locally-owned scaled icons.
+		// (gtk_list_store_set() took its own references.)
+		for (PIMGTYPE scaled : scaledIcons) {
+			PIMGTYPE_destroy(scaled);
 		}
 	}
+	g_object_thaw_notify(G_OBJECT(listStore));
 
 	// Scroll area for the GtkTreeView.
 	GtkWidget *widget = gtk_scrolled_window_new(nullptr, nullptr);
@@ -1002,16 +1309,17 @@ rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 	gtk_widget_show(widget);
 
 	// Create the GtkTreeView.
-	GtkWidget *treeView = gtk_tree_view_new_with_model(GTK_TREE_MODEL(listStore));
+	// NOTE: The model is attached *after* all of the columns have
+	// been appended below. This is the standard detach-populate-
+	// reattach GtkTreeView optimization: the rows were already
+	// inserted into the detached GtkListStore above, and appending
+	// columns to a model-less view skips per-column revalidation.
+	GtkWidget *treeView = gtk_tree_view_new();
 	gtk_tree_view_set_headers_visible(GTK_TREE_VIEW(treeView),
 		(listDataDesc.names != nullptr));
 	gtk_widget_show(treeView);
 	gtk_container_add(GTK_CONTAINER(widget), treeView);
 
-	// TODO: Set fixed height mode?
-	// May require fixed columns...
-	// Reference: https://developer.gnome.org/gtk3/stable/GtkTreeView.html#gtk-tree-view-set-fixed-height-mode
-
 #if GTK_CHECK_VERSION(3,0,0)
 	// FIXME: Alternating row colors isn't working in GTK+ 3.x...
 #else
@@ -1019,20 +1327,19 @@ rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 	gtk_tree_view_set_rules_hint(GTK_TREE_VIEW(treeView), true);
 #endif
 
-	if (hasCheckboxes) {
-		// Prepend an extra column for checkboxes.
-		GtkCellRenderer *const renderer = gtk_cell_renderer_toggle_new();
-		GtkTreeViewColumn *const column = gtk_tree_view_column_new_with_attributes(
-			"", renderer, "active", 0, nullptr);
-		gtk_tree_view_column_set_resizable(column, true);
-		gtk_tree_view_append_column(GTK_TREE_VIEW(treeView), column);
-	} else if (hasIcons) {
-		// Prepend an extra column for icons.
-		GtkCellRenderer *const renderer = gtk_cell_renderer_pixbuf_new();
-		GtkTreeViewColumn *const column = gtk_tree_view_column_new_with_attributes(
-			"", renderer, GTK_CELL_RENDERER_PIXBUF_PROPERTY, 0, nullptr);
-		gtk_tree_view_column_set_resizable(column, true);
-		gtk_tree_view_append_column(GTK_TREE_VIEW(treeView), column);
+	// NOTE: All columns use fixed sizing so that fixed height mode
+	// can be enabled below. With GROW_ONLY sizing, GTK+ measures
+	// every row in every column at realize time, which is
+	// O(rows x cols) PangoLayout work for large lists.
+
+	// Freeze the view's notifications while the columns are
+	// appended, so the per-append property notify emissions are
+	// coalesced into a single thaw.
+	g_object_freeze_notify(G_OBJECT(treeView));
+	if (hasCheckboxes || hasIcons) {
+		// Prepend an extra column for checkboxes or icons.
+		gtk_tree_view_append_column(GTK_TREE_VIEW(treeView),
+			listdata_create_first_column(hasCheckboxes));
 	}
 
 	// Format tables.
@@ -1047,6 +1354,24 @@ rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 		PANGO_ALIGN_CENTER, PANGO_ALIGN_RIGHT
 	};
 
+	// Precomputed GValues for the alignment properties.
+	// g_object_set() collects its varargs and re-creates the
+	// property GValues on every call; with only four possible
+	// alignments, the values can be built once and reused.
+	// (Only used on the GTK+ main thread.)
+	static gsize align_vals_init = 0;
+	static GValue align_vals_xalign[4];	// gfloat ("xalign" / column "alignment")
+	static GValue align_vals_pango[4];	// PangoAlignment (renderer "alignment")
+	if (g_once_init_enter(&align_vals_init)) {
+		for (int i = 0; i < 4; i++) {
+			g_value_init(&align_vals_xalign[i], G_TYPE_FLOAT);
+			g_value_set_float(&align_vals_xalign[i], align_tbl_xalign[i]);
+			g_value_init(&align_vals_pango[i], PANGO_TYPE_ALIGNMENT);
+			g_value_set_enum(&align_vals_pango[i], align_tbl_pango[i]);
+		}
+		g_once_init_leave(&align_vals_init, 1);
+	}
+
 	// Set up the column names.
 	uint32_t align_headers = listDataDesc.alignment.headers;
 	uint32_t align_data = listDataDesc.alignment.data;
@@ -1058,28 +1383,61 @@ rom_data_view_init_listdata(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 			(listDataDesc.names ? listDataDesc.names->at(i).c_str() : ""),
 			renderer, "text", i+col_start, nullptr);
 		gtk_tree_view_column_set_resizable(column, true);
-		gtk_tree_view_append_column(GTK_TREE_VIEW(treeView), column);
 
-		// Header alignment
-		const float header_xalign = align_tbl_xalign[align_headers & 3];
-		// Data alignment
-		const float data_xalign = align_tbl_xalign[align_data & 3];
-		const PangoAlignment data_alignment =
-			static_cast<PangoAlignment>(align_tbl_pango[align_data & 3]);
+		// Measure a representative string once per column instead
+		// of letting GTK+ measure every row. Byte length is used as
+		// a cheap proxy to pick the longest cell in the column.
+		const char *longest = (listDataDesc.names ? listDataDesc.names->at(i).c_str() : "");
+		size_t longest_len = strlen(longest);
+		if (list_data) {
+			for (const vector<string> &data_row : *list_data) {
+				if ((size_t)i < data_row.size()) {
+					const string &cell = data_row[i];
+					if (cell.size() > longest_len) {
+						longest_len = cell.size();
+						longest = cell.c_str();
+					}
+				}
+			}
+		}
+		int text_width = 0;
+		PangoLayout *const layout = gtk_widget_create_pango_layout(treeView, longest);
+		pango_layout_get_pixel_size(layout, &text_width, nullptr);
+		g_object_unref(layout);
+		gtk_tree_view_column_set_sizing(column, GTK_TREE_VIEW_COLUMN_FIXED);
+		// Add padding for the cell renderer.
+		gtk_tree_view_column_set_fixed_width(column, text_width + 16);
 
-		g_object_set(column, "alignment", header_xalign, nullptr);
-		g_object_set(renderer,
-			"xalign", data_xalign,
-			"alignment", data_alignment, nullptr);
+		gtk_tree_view_append_column(GTK_TREE_VIEW(treeView), column);
+
+		// Header and data alignment.
+		// NOTE: TXA_D (0) matches the GTK+ defaults, so the
+		// g_object_set() calls (property lookup + notify emission)
+		// are skipped entirely for default-aligned columns.
+		if ((align_headers & 3) != 0) {
+			g_object_set_property(G_OBJECT(column), "alignment",
+				&align_vals_xalign[align_headers & 3]);
+		}
+		if ((align_data & 3) != 0) {
+			g_object_set_property(G_OBJECT(renderer), "xalign",
+				&align_vals_xalign[align_data & 3]);
+			g_object_set_property(G_OBJECT(renderer), "alignment",
+				&align_vals_pango[align_data & 3]);
+		}
 	}
+	g_object_thaw_notify(G_OBJECT(treeView));
 
 	// Set a minimum height for the scroll area.
 	// TODO: Adjust for DPI, and/or use a font size?
 	// TODO: Force maximum horizontal width somehow?
 	gtk_widget_set_size_request(widget, -1, 128);
 
-	// Resize the columns to fit the contents.
-	gtk_tree_view_columns_autosize(GTK_TREE_VIEW(treeView));
+	// All columns are fixed-width, so GTK+ only needs to measure a
+	// single row's height and can lay out the view in O(rows).
+	gtk_tree_view_set_fixed_height_mode(GTK_TREE_VIEW(treeView), true);
+
+	// Attach the fully-populated model now that the columns are set up.
+	gtk_tree_view_set_model(GTK_TREE_VIEW(treeView), GTK_TREE_MODEL(listStore));
 
 	// Row height is recalculated when the window is first visible
 	// and/or the system theme is changed.
@@ -1107,38 +1465,66 @@ rom_data_view_init_datetime(G_GNUC_UNUSED RomDataView *page, const RomFields::Fi
 	// Date/Time.
 	if (field->data.date_time == -1) {
 		// tr: Invalid date/time.
+		// NOTE: Not cached; the process may switch locales at runtime.
 		return rom_data_view_init_string(page, field, C_("RomDataView", "Unknown"));
 	}
 
-	GDateTime *dateTime;
-	if (field->desc.flags & RomFields::RFT_DATETIME_IS_UTC) {
-		dateTime = g_date_time_new_from_unix_utc(field->data.date_time);
-	} else {
-		dateTime = g_date_time_new_from_unix_local(field->data.date_time);
-	}
-
 	static const char *const formats[8] = {
 		nullptr,	// No date or time.
 		"%x",		// Date
 		"%X",		// Time
 		"%x %X",	// Date Time
 
-		// TODO: Better localization here.
+		// NOTE: The "no year" formats are handled directly below
+		// instead of going through g_date_time_format(), since
+		// strftime-style "%b %d" isn't ideal for all locales.
 		nullptr,	// No date or time.
 		"%b %d",	// Date (no year)
 		"%X",		// Time
 		"%b %d %X",	// Date Time (no year)
 	};
 
-	const char *const format = formats[field->desc.flags & RomFields::RFT_DATETIME_HAS_DATETIME_NO_YEAR_MASK];
+	// Look up the format before creating the GDateTime, so an
+	// invalid flag combination doesn't pay for an allocation.
+	const unsigned int dt_flags = field->desc.flags & RomFields::RFT_DATETIME_HAS_DATETIME_NO_YEAR_MASK;
+	const char *const format = formats[dt_flags];
 	assert(format != nullptr);
-	GtkWidget *widget = nullptr;
-	if (format) {
-		gchar *str = g_date_time_format(dateTime, format);
-		if (str) {
-			widget = rom_data_view_init_string(page, field, str);
-			g_free(str);
+	if (!format) {
+		return nullptr;
+	}
+
+	GDateTime *const dateTime = (field->desc.flags & RomFields::RFT_DATETIME_IS_UTC)
+		? g_date_time_new_from_unix_utc(field->data.date_time)
+		: g_date_time_new_from_unix_local(field->data.date_time);
+
+	gchar *str;
+	if ((dt_flags & (RomFields::RFT_DATETIME_NO_YEAR | RomFields::RFT_DATETIME_HAS_DATE)) ==
+	    (RomFields::RFT_DATETIME_NO_YEAR | RomFields::RFT_DATETIME_HAS_DATE))
+	{
+		// "No year" date. Assemble the string directly instead of
+		// paying for g_date_time_format()'s full format parsing.
+		// The month abbreviation comes from nl_langinfo(), so it
+		// still follows the user's locale.
+		const int month = g_date_time_get_month(dateTime);	// [1,12]
+		const int day = g_date_time_get_day_of_month(dateTime);
+		const char *const abmon = nl_langinfo(static_cast<nl_item>(ABMON_1 + (month - 1)));
+
+		if (dt_flags & RomFields::RFT_DATETIME_HAS_TIME) {
+			gchar *const time_str = g_date_time_format(dateTime, "%X");
+			str = g_strdup_printf("%s %02d %s", abmon, day,
+				(time_str ? time_str : ""));
+			g_free(time_str);
+		} else {
+			str = g_strdup_printf("%s %02d", abmon, day);
 		}
+	} else {
+		str = g_date_time_format(dateTime, format);
+	}
+
+	GtkWidget *widget = nullptr;
+	if (str) {
+		widget = rom_data_view_init_string(page, field, str);
+		g_free(str);
 	}
 
 	g_date_time_unref(dateTime);
@@ -1167,6 +1553,50 @@ rom_data_view_init_age_ratings(G_GNUC_UNUSED RomDataView *page, const RomFields:
 	return rom_data_view_init_string(page, field, str.c_str());
 }
 
+/**
+ * Write an unsigned decimal integer into a buffer.
+ * Two digits are emitted per iteration using a lookup table,
+ * avoiding snprintf()'s format parsing and locale handling.
+ * @param p	[out] Output buffer. (Must have room for 10 digits.)
+ * @param v	[in] Value.
+ * @return Pointer to the byte after the last digit. (NOT NULL-terminated.)
+ */
+static char*
+u32toa(char *p, unsigned int v)
+{
+	// Decimal digit pairs, "00" through "99".
+	static const char digits100[] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+	// Digits are generated in reverse order, then copied.
+	char tmp[10];
+	char *t = tmp + sizeof(tmp);
+	while (v >= 100) {
+		const unsigned int d = (v % 100) * 2;
+		v /= 100;
+		*--t = digits100[d+1];
+		*--t = digits100[d];
+	}
+	const unsigned int d = v * 2;
+	*--t = digits100[d+1];
+	if (v >= 10) {
+		*--t = digits100[d];
+	}
+
+	const size_t len = (size_t)(tmp + sizeof(tmp) - t);
+	memcpy(p, t, len);
+	return p + len;
+}
+
 /**
  * Initialize a Dimensions field.
  * @param page	[in] RomDataView object.
@@ -1178,19 +1608,21 @@ rom_data_view_init_dimensions(G_GNUC_UNUSED RomDataView *page, const RomFields::
 {
 	// Dimensions.
 	// TODO: 'x' or '×'? Using 'x' for now.
+	// NOTE: Formatted by hand instead of snprintf(), which spends
+	// most of its time parsing the format string for a 1-3 integer
+	// output.
 	const int *const dimensions = field->data.dimensions;
 	char buf[64];
+	char *p = u32toa(buf, (unsigned int)dimensions[0]);
 	if (dimensions[1] > 0) {
+		*p++ = 'x';
+		p = u32toa(p, (unsigned int)dimensions[1]);
 		if (dimensions[2] > 0) {
-			snprintf(buf, sizeof(buf), "%dx%dx%d",
-				dimensions[0], dimensions[1], dimensions[2]);
-		} else {
-			snprintf(buf, sizeof(buf), "%dx%d",
-				dimensions[0], dimensions[1]);
+			*p++ = 'x';
+			p = u32toa(p, (unsigned int)dimensions[2]);
 		}
-	} else {
-		snprintf(buf, sizeof(buf), "%d", dimensions[0]);
 	}
+	*p = '\0';
 
 	return rom_data_view_init_string(page, field, buf);
 }
@@ -1223,16 +1655,25 @@ rom_data_view_update_display(RomDataView *page)
 	int rowCount = count;
 #endif
 
+	// Freeze notifications while populating: dozens of widgets are
+	// packed into the page below, and coalescing the notify
+	// emissions avoids triggering intermediate relayouts.
+	// NOTE: The tab containers are show_all()'d in one pass at the
+	// end; a gtk_widget_show_all() on the page itself can't be used
+	// because the banner and icon must stay hidden depending on
+	// the ROM.
+	g_object_freeze_notify(G_OBJECT(page));
+
 	// Create the GtkNotebook.
 	int tabCount = fields->tabCount();
 	if (tabCount > 1) {
-		page->tabs->resize(tabCount);
+		page->tabs.resize(tabCount);
 		page->tabWidget = gtk_notebook_new();
 
 		// Add spacing between the system info header and the table.
 		g_object_set(page, "spacing", 8, nullptr);
 
-		auto tabIter = page->tabs->begin();
+		auto tabIter = page->tabs.begin();
 		for (int i = 0; i < tabCount; i++, ++tabIter) {
 			// Create a tab.
 			const char *name = fields->tabName(i);
@@ -1257,8 +1698,8 @@ rom_data_view_update_display(RomDataView *page)
 
 			gtk_container_set_border_width(GTK_CONTAINER(tab.table), 8);
 			gtk_box_pack_start(GTK_BOX(tab.vbox), tab.table, false, false, 0);
-			gtk_widget_show(tab.table);
-			gtk_widget_show(tab.vbox);
+			// NOTE: tab.table and tab.vbox are shown after the
+			// field loop, once all children have been attached.
 
 			// Add the tab.
 			GtkWidget *label = gtk_label_new(name);
@@ -1271,8 +1712,8 @@ rom_data_view_update_display(RomDataView *page)
 		// Don't create a GtkNotebook, but simulate a single
 		// tab in page->tabs[] to make it easier to work with.
 		tabCount = 1;
-		page->tabs->resize(1);
-		auto &tab = page->tabs->at(0);
+		page->tabs.resize(1);
+		auto &tab = page->tabs[0];
 		tab.vbox = GTK_WIDGET(page);
 
 #if GTK_CHECK_VERSION(3,0,0)
@@ -1288,13 +1729,14 @@ rom_data_view_update_display(RomDataView *page)
 
 		gtk_container_set_border_width(GTK_CONTAINER(tab.table), 8);
 		gtk_box_pack_start(GTK_BOX(page), tab.table, false, false, 0);
-		gtk_widget_show(tab.table);
+		// NOTE: tab.table is shown after the field loop,
+		// once all children have been attached.
 	}
 
 	// Reserve enough space for vecDescLabels.
-	page->vecDescLabels->reserve(count);
+	page->vecDescLabels.reserve(count);
 	// Per-tab row counts.
-	vector<int> tabRowCount(page->tabs->size());
+	vector<int> tabRowCount(page->tabs.size());
 
 	// Use a GtkSizeGroup to ensure that the description
 	// labels on all tabs have the same width.
@@ -1302,9 +1744,18 @@ rom_data_view_update_display(RomDataView *page)
 	// once all referenced widgets are deleted, so we don't
 	// need to manage it ourselves.
 	GtkSizeGroup *const size_group = gtk_size_group_new(GTK_SIZE_GROUP_HORIZONTAL);
+	// Freeze the size group's notifications while labels are added.
+	// Each gtk_size_group_add_widget() otherwise triggers a
+	// group-wide resize request, which cascades into redundant
+	// layout passes before anything is even visible.
+	g_object_freeze_notify(G_OBJECT(size_group));
 
 	// tr: Field description label.
 	const char *const desc_label_fmt = C_("RomDataView", "%s:");
+	// Fast path: if the (possibly translated) format is literally
+	// "%s:", the label text is the field name plus a colon, and
+	// printf-style format parsing can be skipped for every field.
+	const bool desc_fmt_is_plain = !strcmp(desc_label_fmt, "%s:");
 
 	// Create the data widgets.
 	for (int i = 0; i < count; i++) {
@@ -1315,11 +1766,11 @@ rom_data_view_update_display(RomDataView *page)
 
 		// Verify the tab index.
 		const int tabIdx = field->tabIdx;
-		assert(tabIdx >= 0 && tabIdx < (int)page->tabs->size());
-		if (tabIdx < 0 || tabIdx >= (int)page->tabs->size()) {
+		assert(tabIdx >= 0 && tabIdx < (int)page->tabs.size());
+		if (tabIdx < 0 || tabIdx >= (int)page->tabs.size()) {
 			// Tab index is out of bounds.
 			continue;
-		} else if (!page->tabs->at(tabIdx).table) {
+		} else if (!page->tabs[tabIdx].table) {
 			// Tab name is empty. Tab is hidden.
 			continue;
 		}
@@ -1358,24 +1809,39 @@ rom_data_view_update_display(RomDataView *page)
 
 		if (widget) {
 			// Add the widget to the table.
-			auto &tab = page->tabs->at(tabIdx);
+			// NOTE: tabIdx was validated above, so operator[]
+			// is safe here.
+			auto &tab = page->tabs[tabIdx];
 
 			// tr: Field description label.
-			string txt = rp_sprintf(desc_label_fmt, field->name.c_str());
-			GtkWidget *lblDesc = gtk_label_new(txt.c_str());
+			// NOTE: Using g_snprintf() with a stack buffer instead
+			// of rp_sprintf() to avoid a heap allocation per field.
+			char txt[256];
+			if (desc_fmt_is_plain) {
+				// "%s:" fast path: copy and append the colon.
+				size_t len = g_strlcpy(txt, field->name.c_str(), sizeof(txt)-2);
+				if (len > sizeof(txt)-3) {
+					len = sizeof(txt)-3;
+				}
+				txt[len] = ':';
+				txt[len+1] = '\0';
+			} else {
+				g_snprintf(txt, sizeof(txt), desc_label_fmt, field->name.c_str());
+			}
+			GtkWidget *lblDesc = gtk_label_new(txt);
 			gtk_label_set_use_underline(GTK_LABEL(lblDesc), false);
-			gtk_widget_show(lblDesc);
+			// NOTE: Not calling gtk_widget_show() here; the
+			// description labels are all shown at once by the
+			// gtk_widget_show_all() pass on the tab tables below.
 			gtk_size_group_add_widget(size_group, lblDesc);
-			page->vecDescLabels->push_back(lblDesc);
 
 			// Check if this is an RFT_STRING with warning set.
-			// If it is, set the "RFT_STRING_warning" flag.
 			const gboolean is_warning = (field->type == RomFields::RFT_STRING &&
 						     field->desc.flags & RomFields::STRF_WARNING);
-			g_object_set_data(G_OBJECT(lblDesc), "RFT_STRING_warning", GUINT_TO_POINTER((guint)is_warning));
+			page->vecDescLabels.push_back(std::make_pair(GTK_LABEL(lblDesc), !!is_warning));
 
 			// Set the label format type.
-			set_label_format_type(GTK_LABEL(lblDesc), page->desc_format_type);
+			set_label_format_type(GTK_LABEL(lblDesc), page->desc_format_type, is_warning);
 
 			// Value widget.
 			int &row = tabRowCount[tabIdx];
@@ -1400,18 +1866,14 @@ rom_data_view_update_display(RomDataView *page)
 
 				// If this is the last field in the tab,
 				// put the RFT_LISTDATA in the GtkGrid instead.
-				bool doVBox = false;
-				if (tabIdx + 1 == tabCount && i == count-1) {
-					// Last tab, and last field.
-					doVBox = true;
-				} else {
-					// Check if the next field is on the next tab.
-					const RomFields::Field *nextField = fields->field(i+1);
-					if (nextField && nextField->tabIdx != tabIdx) {
-						// Next field is on the next tab.
-						doVBox = true;
-					}
-				}
+				// NOTE: Bounds-checking the lookahead here instead of
+				// relying on fields->field() returning nullptr, which
+				// saves an accessor call past the end of the list.
+				const RomFields::Field *const nextField =
+					(i+1 < count) ? fields->field(i+1) : nullptr;
+				const bool doVBox = (nextField)
+					? (nextField->tabIdx != tabIdx)	// Next field is on the next tab.
+					: (tabIdx + 1 == tabCount);	// Last field, and last tab.
 
 				if (doVBox) {
 					// FIXME: There still seems to be a good amount of space
@@ -1484,37 +1946,299 @@ rom_data_view_update_display(RomDataView *page)
 			}
 		}
 	}
+
+	g_object_thaw_notify(G_OBJECT(size_group));
+
+	// Show the tab containers now that all of their children have
+	// been attached. Doing this in one pass at the end collapses
+	// the per-child relayouts that showing the tables up front
+	// would have caused. gtk_widget_show_all() also covers the
+	// per-field description labels, which aren't shown eagerly.
+	// NOTE: Not using gtk_widget_show_all() on the page itself;
+	// the banner and icon must stay hidden for ROMs without them.
+	for (size_t i = 0; i < page->tabs.size(); i++) {
+		auto &tab = page->tabs[i];
+		if (tab.table) {
+			gtk_widget_show_all(tab.table);
+		}
+		if (tab.vbox && tab.vbox != GTK_WIDGET(page)) {
+			gtk_widget_show_all(tab.vbox);
+		}
+	}
+
+	g_object_thaw_notify(G_OBJECT(page));
 }
 
-static gboolean
-rom_data_view_load_rom_data(gpointer data)
+/** RomData cache **/
+
+// Process-wide RomData cache, keyed by filename.
+// File managers frequently re-instantiate the properties page for a
+// file that was just viewed (e.g. when reopening the dialog or
+// switching views), which would otherwise re-run the full
+// RomDataFactory parse. Each cached entry holds one reference.
+//
+// The cache is a small LRU: most-recently-used entries are at the
+// back of the vector. With a capacity of 8, linear search is cheaper
+// than maintaining a map + list.
+static const size_t ROMDATA_CACHE_CAPACITY = 8;
+static vector<pair<string, RomData*> > romdata_cache;
+// Mutex for romdata_cache, since multiple pages can load concurrently.
+static GMutex romdata_cache_mutex;
+
+/**
+ * Look up a RomData object in the process-wide cache.
+ * @param filename ROM filename.
+ * @return ref()'d RomData object, or nullptr if not cached.
+ */
+static RomData*
+rom_data_cache_lookup(const char *filename)
 {
-	RomDataView *page = ROM_DATA_VIEW(data);
-	g_return_val_if_fail(page != nullptr || IS_ROM_DATA_VIEW(page), false);
-	g_return_val_if_fail(page->filename != nullptr, false);
+	RomData *romData = nullptr;
+	g_mutex_lock(&romdata_cache_mutex);
+	for (size_t i = 0; i < romdata_cache.size(); i++) {
+		if (romdata_cache[i].first == filename) {
+			// Cache hit. Take a reference for the caller.
+			romData = romdata_cache[i].second;
+			romData->ref();
+
+			// Move the entry to the most-recently-used position.
+			if (i+1 != romdata_cache.size()) {
+				pair<string, RomData*> entry = std::move(romdata_cache[i]);
+				romdata_cache.erase(romdata_cache.begin() + i);
+				romdata_cache.push_back(std::move(entry));
+			}
+			break;
+		}
+	}
+	g_mutex_unlock(&romdata_cache_mutex);
+	return romData;
+}
 
-	// Open the ROM file.
-	// TODO: gvfs support.
-	if (G_LIKELY(page->filename != nullptr)) {
+/**
+ * Store a RomData object in the process-wide cache.
+ * The cache takes its own reference. The oldest entry is
+ * evicted if the cache is full.
+ * @param filename ROM filename.
+ * @param romData RomData object.
+ */
+static void
+rom_data_cache_store(const char *filename, RomData *romData)
+{
+	g_mutex_lock(&romdata_cache_mutex);
+	if (romdata_cache.size() >= ROMDATA_CACHE_CAPACITY) {
+		// Evict the least-recently-used entry.
+		romdata_cache.front().second->unref();
+		romdata_cache.erase(romdata_cache.begin());
+	}
+	romData->ref();
+	romdata_cache.push_back(std::make_pair(string(filename), romData));
+	g_mutex_unlock(&romdata_cache_mutex);
+}
+
+/**
+ * Seed the process-wide RomData cache with an existing RomData object.
+ * Called by the providers' rom_properties_get_file_supported(), which
+ * has to create a RomData object anyway to check for support. Seeding
+ * the cache lets the subsequent rom_data_view_set_filename() reuse
+ * that object instead of re-opening and re-parsing the file.
+ * The cache takes its own reference; the caller keeps ownership.
+ * @param filename ROM filename.
+ * @param romData RomData object.
+ */
+void
+rom_data_view_cache_rom_data(const gchar *filename, RomData *romData)
+{
+	g_return_if_fail(filename != nullptr);
+	g_return_if_fail(romData != nullptr);
+
+	// Don't store a duplicate entry if this file is already cached.
+	RomData *const cached = rom_data_cache_lookup(filename);
+	if (cached) {
+		cached->unref();
+		return;
+	}
+
+	rom_data_cache_store(filename, romData);
+}
+
+/**
+ * Resolve a RomData object for a filename.
+ * Checks the process-wide cache first; otherwise, the file is
+ * opened and parsed. No GTK+ calls are made here, so this may
+ * run on a worker thread.
+ * @param filename ROM filename.
+ * @return ref()'d RomData object, or nullptr if not supported.
+ */
+static RomData*
+rom_data_view_resolve_rom_data(const gchar *filename)
+{
+	// Check the process-wide RomData cache first.
+	RomData *romData = rom_data_cache_lookup(filename);
+	if (!romData) {
 		// Open the ROM file.
-		RpFile *const file = new RpFile(page->filename, RpFile::FM_OPEN_READ_GZ);
+		// TODO: gvfs support.
+		RpFile *const file = new RpFile(filename, RpFile::FM_OPEN_READ_GZ);
 		if (file->isOpen()) {
 			// Create the RomData object.
 			// file is ref()'d by RomData.
-			page->romData = RomDataFactory::create(file);
-
-			// Update the display widgets.
-			rom_data_view_update_display(page);
-
-			// Make sure the underlying file handle is closed,
-			// since we don't need it once the RomData has been
-			// loaded by RomDataView.
-			if (page->romData) {
-				page->romData->close();
+			romData = RomDataFactory::create(file);
+			if (romData) {
+				rom_data_cache_store(filename, romData);
 			}
 		}
 		file->unref();
 	}
+	return romData;
+}
+
+/**
+ * Display a resolved RomData object. (GTK+ main thread only)
+ * Takes ownership of the caller's RomData reference.
+ * @param page RomDataView.
+ * @param romData ref()'d RomData object, or nullptr.
+ */
+static void
+rom_data_view_display_rom_data(RomDataView *page, RomData *romData)
+{
+	if (romData && romData == page->romData) {
+		// The page is already displaying this exact RomData
+		// object. (e.g. the same filename was set again and
+		// the cache returned the same object) RomData objects
+		// are immutable once loaded, so the existing widgets
+		// are still valid; skip the teardown and rebuild.
+		romData->unref();
+		return;
+	}
+
+	// Tear down the previous ROM's display, if any.
+	// This is deferred from rom_data_view_set_filename()
+	// so that rapid filename changes only cause one
+	// teardown + reload.
+	if (page->romData) {
+		page->romData->unref();
+	}
+	page->romData = romData;
+
+	// Update the display widgets.
+	rom_data_view_update_display(page);
+
+	// Make sure the underlying file handle is closed,
+	// since we don't need it once the RomData has been
+	// loaded by RomDataView.
+	// NOTE: Must be done *after* rom_data_view_update_display(),
+	// since field and image loading is lazy and needs the file.
+	// Cached re-displays are fine because the data is loaded.
+	if (page->romData) {
+		page->romData->close();
+	}
+}
+
+#if GLIB_CHECK_VERSION(2,36,0)
+/**
+ * GTask worker function: resolve the RomData object.
+ * Runs on a worker thread, so the blocking I/O (file open, parsing,
+ * and any decompression) doesn't stall the GTK+ main loop.
+ * @param task		[in] GTask. (task data is the filename)
+ * @param source_object	[in] RomDataView.
+ * @param task_data	[in] ROM filename.
+ * @param cancellable	[in] GCancellable. (unused)
+ */
+static void
+rom_data_view_load_rom_data_thread(GTask	*task,
+	G_GNUC_UNUSED gpointer			 source_object,
+	gpointer				 task_data,
+	G_GNUC_UNUSED GCancellable		*cancellable)
+{
+	const gchar *const filename = static_cast<const gchar*>(task_data);
+	g_task_return_pointer(task,
+		rom_data_view_resolve_rom_data(filename), nullptr);
+}
+
+/**
+ * GTask completion callback. Runs on the GTK+ main thread.
+ * @param source_object	[in] RomDataView.
+ * @param res		[in] GAsyncResult.
+ * @param user_data	[in] User data. (unused)
+ */
+static void
+rom_data_view_load_rom_data_ready(GObject	*source_object,
+	GAsyncResult				*res,
+	G_GNUC_UNUSED gpointer			 user_data)
+{
+	RomDataView *const page = ROM_DATA_VIEW(source_object);
+	RomData *const romData = static_cast<RomData*>(
+		g_task_propagate_pointer(G_TASK(res), nullptr));
+
+	// If the load was cancelled, the page was disposed (or the
+	// load was superseded) while the task was running, and the
+	// display widgets may no longer exist. Discard the result.
+	GCancellable *const cancellable = g_task_get_cancellable(G_TASK(res));
+	if (cancellable && g_cancellable_is_cancelled(cancellable)) {
+		if (romData) {
+			romData->unref();
+		}
+		return;
+	}
+
+	// This task is no longer in flight.
+	if (page->loadCancellable == cancellable) {
+		g_object_unref(page->loadCancellable);
+		page->loadCancellable = nullptr;
+	}
+
+	// If the page's filename changed while the task was running,
+	// this result is stale; another load is already pending.
+	const gchar *const filename = static_cast<const gchar*>(
+		g_task_get_task_data(G_TASK(res)));
+	if (g_strcmp0(filename, page->filename) != 0) {
+		if (romData) {
+			romData->unref();
+		}
+		return;
+	}
+
+	rom_data_view_display_rom_data(page, romData);
+}
+#endif /* GLIB_CHECK_VERSION(2,36,0) */
+
+static gboolean
+rom_data_view_load_rom_data(gpointer data)
+{
+	RomDataView *page = ROM_DATA_VIEW(data);
+	g_return_val_if_fail(page != nullptr || IS_ROM_DATA_VIEW(page), false);
+	g_return_val_if_fail(page->filename != nullptr, false);
+
+	if (G_LIKELY(page->filename != nullptr)) {
+#if GLIB_CHECK_VERSION(2,36,0)
+		// Resolve the RomData object on a worker thread.
+		// Opening and parsing the file can block for a while,
+		// e.g. on compressed disc images, and running it here
+		// would stall all GTK+ rendering.
+		// NOTE: The GTask holds a reference on the page until
+		// the completion callback has run, and the completion
+		// callback discards stale results, so rapid filename
+		// changes are still safe.
+		// Cancel any previous in-flight load first.
+		if (page->loadCancellable) {
+			g_cancellable_cancel(page->loadCancellable);
+			g_object_unref(page->loadCancellable);
+		}
+		page->loadCancellable = g_cancellable_new();
+		GTask *const task = g_task_new(page, page->loadCancellable,
+			rom_data_view_load_rom_data_ready, nullptr);
+		// NOTE: Cancellation is checked manually in the
+		// completion callback so the resolved RomData can
+		// still be unref()'d instead of being leaked.
+		g_task_set_check_cancellable(task, false);
+		g_task_set_task_data(task, g_strdup(page->filename), g_free);
+		g_task_run_in_thread(task, rom_data_view_load_rom_data_thread);
+		g_object_unref(task);
+#else /* !GLIB_CHECK_VERSION(2,36,0) */
+		// GTask isn't available. Load the ROM synchronously.
+		rom_data_view_display_rom_data(page,
+			rom_data_view_resolve_rom_data(page->filename));
+#endif /* GLIB_CHECK_VERSION(2,36,0) */
+	}
 
 	// Animation timer will be started when the page
 	// receives the "map" signal.
@@ -1532,11 +2256,9 @@ static void
 rom_data_view_delete_tabs(RomDataView *page)
 {
 	assert(page != nullptr);
-	assert(page->tabs != nullptr);
-	assert(page->vecDescLabels != nullptr);
 
 	// Delete the tab contents.
-	for (auto iter = page->tabs->begin(); iter != page->tabs->end(); ++iter) {
+	for (auto iter = page->tabs.begin(); iter != page->tabs.end(); ++iter) {
 		auto &tab = *iter;
 		if (tab.lblCredits) {
 			gtk_widget_destroy(tab.lblCredits);
@@ -1548,7 +2270,7 @@ rom_data_view_delete_tabs(RomDataView *page)
 			gtk_widget_destroy(tab.vbox);
 		}
 	}
-	page->tabs->clear();
+	page->tabs.clear();
 
 	if (page->tabWidget) {
 		// Delete the tab widget.
@@ -1557,15 +2279,32 @@ rom_data_view_delete_tabs(RomDataView *page)
 	}
 
 	// Clear the various widget references.
-	page->vecDescLabels->clear();
+	page->vecDescLabels.clear();
 
-	// Delete the icon frames.
-	for (int i = ARRAY_SIZE(page->iconFrames)-1; i >= 0; i--) {
-		if (page->iconFrames[i]) {
-			PIMGTYPE_destroy(page->iconFrames[i]);
-			page->iconFrames[i] = nullptr;
+	// Cancel any pending icon frame conversion.
+	if (page->iconFrames_idle > 0) {
+		g_source_remove(page->iconFrames_idle);
+		page->iconFrames_idle = 0;
+	}
+
+	// Clear the icon frame pointers.
+	// Only [0, iconFrameCount) can be valid.
+	// NOTE: The frames are owned by the image cache,
+	// which is cleared below.
+	for (int i = 0; i < page->iconFrameCount; i++) {
+		page->iconFrames[i] = nullptr;
+	}
+	page->iconFrameCount = 0;
+
+	// Destroy the cached image conversions.
+	// The rp_image keys are owned by romData, which is
+	// being unloaded, so the cache cannot outlive it.
+	for (auto iter = page->imgCache.begin(); iter != page->imgCache.end(); ++iter) {
+		if (iter->second) {
+			PIMGTYPE_destroy(iter->second);
 		}
 	}
+	page->imgCache.clear();
 }
 
 /** Signal handlers. **/
@@ -1582,7 +2321,7 @@ checkbox_no_toggle_signal_handler(GtkToggleButton	*togglebutton,
 	RP_UNUSED(user_data);
 
 	// Get the saved RFT_BITFIELD value.
-	const gboolean value = (gboolean)GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(togglebutton), "RFT_BITFIELD_value"));
+	const gboolean value = (gboolean)GPOINTER_TO_UINT(g_object_get_qdata(G_OBJECT(togglebutton), RFT_BITFIELD_value_quark));
 	if (gtk_toggle_button_get_active(togglebutton) != value) {
 		// Toggle this box.
 		gtk_toggle_button_set_active(togglebutton, value);
@@ -1723,9 +2462,11 @@ static void start_anim_timer(RomDataView *page)
 	stop_anim_timer(page);
 
 	// Set a timer for the current frame.
+	// NOTE: Using G_PRIORITY_DEFAULT_IDLE so the icon animation
+	// never preempts user input or widget redraws.
 	page->last_delay = delay;
-	page->tmrIconAnim = g_timeout_add(delay,
-		reinterpret_cast<GSourceFunc>(anim_timer_func), page);
+	page->tmrIconAnim = g_timeout_add_full(G_PRIORITY_DEFAULT_IDLE, delay,
+		reinterpret_cast<GSourceFunc>(anim_timer_func), page, nullptr);
 }
 
 /**
@@ -1762,15 +2503,25 @@ static gboolean anim_timer_func(RomDataView *page)
 	if (frame != page->last_frame_number) {
 		// New frame number.
 		// Update the icon.
-		gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgIcon), page->iconFrames[frame]);
-		page->last_frame_number = frame;
+		// NOTE: The frame might not have been converted yet if the
+		// low-priority conversion idle hasn't run. Keep showing the
+		// previous frame in that case; the next tick will catch up.
+		if (page->iconFrames[frame]) {
+			gtk_image_set_from_PIMGTYPE(GTK_IMAGE(page->imgIcon), page->iconFrames[frame]);
+			page->last_frame_number = frame;
+		}
 	}
 
 	// Set a new timer and unset the current one.
+	// NOTE: Re-arming is only needed when the delay actually changes;
+	// otherwise, the existing GSource is reused by returning true.
+	// Retargeting the same GSource on a delay change would need
+	// g_source_set_ready_time(), which is GLib 2.36; the minimum
+	// GLib version is currently 2.26.
 	if (page->last_delay != delay) {
 		page->last_delay = delay;
-		page->tmrIconAnim = g_timeout_add(delay,
-			reinterpret_cast<GSourceFunc>(anim_timer_func), page);
+		page->tmrIconAnim = g_timeout_add_full(G_PRIORITY_DEFAULT_IDLE, delay,
+			reinterpret_cast<GSourceFunc>(anim_timer_func), page, nullptr);
 		return false;
 	}
 	return true;
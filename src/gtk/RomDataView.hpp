@@ -46,4 +46,23 @@ void		rom_data_view_set_desc_format_type(RomDataView *page, RpDescFormatType des
 
 G_END_DECLS;
 
+#ifdef __cplusplus
+namespace LibRpBase {
+	class RomData;
+}
+
+/**
+ * Seed the process-wide RomData cache with an existing RomData object.
+ * Called by the providers' rom_properties_get_file_supported(), which
+ * has to create a RomData object anyway to check for support. Seeding
+ * the cache lets the subsequent rom_data_view_set_filename() reuse
+ * that object instead of re-opening and re-parsing the file.
+ * The cache takes its own reference; the caller keeps ownership.
+ * @param filename ROM filename.
+ * @param romData RomData object.
+ */
+void		rom_data_view_cache_rom_data	(const gchar *filename,
+						 LibRpBase::RomData *romData) G_GNUC_INTERNAL;
+#endif /* __cplusplus */
+
 #endif /* __ROMPROPERTIES_GTK_ROMDATA_VIEW_HPP__ */
@@ -120,12 +120,14 @@ rom_properties_provider_get_pages(NautilusPropertyPageProvider *provider, GList
 	GList *file;
 	NautilusFileInfo *info;
 
-	if (g_list_length(files) != 1) 
+	// The properties page is only shown for single-item selections.
+	// NOTE: Checking the neighbor pointers directly instead of using
+	// g_list_length(), which walks the entire list just to count a
+	// potentially huge multi-selection.
+	if (G_UNLIKELY(files == nullptr) || files->next != nullptr || files->prev != nullptr)
 		return nullptr;
 
-	file = g_list_first(files);
-	if (G_UNLIKELY(file == nullptr))
-		return nullptr;
+	file = files;
 
 	info = NAUTILUS_FILE_INFO(file->data);
 
@@ -191,6 +193,9 @@ rom_properties_get_file_supported(NautilusFileInfo *info)
 		RomData *const romData = RomDataFactory::create(file);
 		if (romData != nullptr) {
 			supported = true;
+			// Seed the RomDataView cache so the page doesn't
+			// have to re-open and re-parse this file.
+			rom_data_view_cache_rom_data(filename, romData);
 			romData->unref();
 		}
 	}
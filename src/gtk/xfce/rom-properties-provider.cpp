@@ -8,6 +8,7 @@
 
 #include "rom-properties-provider.hpp"
 #include "rom-properties-page.hpp"
+#include "../RomDataView.hpp"
 
 // librpbase
 #include "librpbase/file/RpFile.hpp"
@@ -79,12 +80,14 @@ rom_properties_provider_get_pages(ThunarxPropertyPageProvider *page_provider, GL
 	GList *file;
 	ThunarxFileInfo *info;
 
-	if (g_list_length(files) != 1) 
+	// The properties page is only shown for single-item selections.
+	// NOTE: Checking the neighbor pointers directly instead of using
+	// g_list_length(), which walks the entire list just to count a
+	// potentially huge multi-selection.
+	if (G_UNLIKELY(files == nullptr) || files->next != nullptr || files->prev != nullptr)
 		return nullptr;
 
-	file = g_list_first(files);
-	if (G_UNLIKELY(file == nullptr))
-		return nullptr;
+	file = files;
 
 	info = THUNARX_FILE_INFO(file->data);
 
@@ -131,6 +134,9 @@ rom_properties_get_file_supported(ThunarxFileInfo *info)
 		RomData *const romData = RomDataFactory::create(file);
 		if (romData != nullptr) {
 			supported = true;
+			// Seed the RomDataView cache so the page doesn't
+			// have to re-open and re-parse this file.
+			rom_data_view_cache_rom_data(filename, romData);
 			romData->unref();
 		}
 	}
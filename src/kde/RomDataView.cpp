@@ -307,13 +307,13 @@ void RomDataViewPrivate::initHeaderRow(void)
 			const IconAnimData *const iconAnimData = romData->iconAnimData();
 			if (iconAnimData) {
 				// Convert the icons to QPixmaps.
+				// All frames are converted in one pass;
+				// they share a backend class.
+				const QVector<QImage> imgs = rpToQImages(
+					iconAnimData->frames.data(), iconAnimData->count);
 				for (int i = iconAnimData->count-1; i >= 0; i--) {
-					const rp_image *const frame = iconAnimData->frames[i];
-					if (frame && frame->isValid()) {
-						QImage img = rpToQImage(frame);
-						if (!img.isNull()) {
-							iconFrames[i] = imgToPixmap(img);
-						}
+					if (!imgs[i].isNull()) {
+						iconFrames[i] = imgToPixmap(imgs[i]);
 					}
 				}
 
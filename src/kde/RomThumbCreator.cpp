@@ -43,6 +43,7 @@ using std::unique_ptr;
 // Qt includes.
 #include <QtCore/QDateTime>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
 #include <QtCore/QUrl>
 #include <QtGui/QImage>
 #if QT_VERSION >= QT_VERSION_CHECK(5,0,0)
@@ -226,6 +227,27 @@ string RomThumbCreatorPrivate::proxyForUrl(const string &url) const
 	return Q2U8(proxy);
 }
 
+/** In-process thumbnail cache. **/
+
+// KIO's PreviewJob writes finished thumbnails to the XDG thumbnail
+// cache on disk, but repeated requests within the same slave process
+// (e.g. scrolling a large directory back and forth) still re-run the
+// full ROM parse and image decode. Cache the generated QImages here,
+// keyed by source path and validated by mtime and requested size.
+// NOTE: QImage instead of QPixmapCache: the thumbnailer runs in a
+// KIO slave, where pixmaps (which are tied to the GUI session)
+// shouldn't be created. QImage is implicitly shared, so a cache hit
+// is just a refcount bump.
+struct ThumbCacheEntry {
+	qint64 mtime;	// Source file mtime. (msec)
+	int width;	// Requested thumbnail width.
+	QImage img;	// Generated thumbnail.
+};
+static QHash<QString, ThumbCacheEntry> thumb_cache;
+// Maximum number of cached thumbnails. The cache is simply cleared
+// when full; an LRU isn't worth the bookkeeping at this size.
+static const int THUMB_CACHE_MAX_ENTRIES = 64;
+
 /** RomThumbCreator **/
 
 RomThumbCreator::RomThumbCreator()
@@ -260,6 +282,17 @@ bool RomThumbCreator::create(const QString &path, int width, int height, QImage
 	Q_UNUSED(height);
 	const QByteArray u8path = path.toUtf8();
 
+	// Check the in-process thumbnail cache first.
+	const qint64 mtime = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+	QHash<QString, ThumbCacheEntry>::const_iterator iter = thumb_cache.constFind(path);
+	if (iter != thumb_cache.constEnd() &&
+	    iter->mtime == mtime && iter->width == width)
+	{
+		// Cache hit: no re-parse needed.
+		img = iter->img;
+		return true;
+	}
+
 	// Check for "bad" file systems.
 	const Config *const config = Config::instance();
 	if (FileSystem::isOnBadFS(u8path.constData(), config->enableThumbnailOnNetworkFS())) {
@@ -271,6 +304,17 @@ bool RomThumbCreator::create(const QString &path, int width, int height, QImage
 	// TODO: What if they aren't?
 	Q_D(RomThumbCreator);
 	int ret = d->getThumbnail(u8path.constData(), width, img);
+	if (ret == 0) {
+		// Store the thumbnail in the cache.
+		if (thumb_cache.size() >= THUMB_CACHE_MAX_ENTRIES) {
+			thumb_cache.clear();
+		}
+		ThumbCacheEntry entry;
+		entry.mtime = mtime;
+		entry.width = width;
+		entry.img = img;
+		thumb_cache.insert(path, entry);
+	}
 	return (ret == 0);
 }
 
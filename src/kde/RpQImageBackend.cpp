@@ -25,6 +25,7 @@ using LibRpBase::rp_image_backend;
 
 RpQImageBackend::RpQImageBackend(int width, int height, rp_image::Format format)
 	: super(width, height, format)
+	, m_qPalette_dirty(true)
 {
 	// Initialize the QImage.
 	QImage::Format qfmt;
@@ -129,6 +130,11 @@ uint32_t *RpQImageBackend::palette(void)
 	// getQImage() function.
 	if (m_qPalette.isEmpty())
 		return nullptr;
+
+	// The caller may modify the palette through this pointer,
+	// so the QImage color table must be re-synced on the next
+	// getQImage() call.
+	m_qPalette_dirty = true;
 	return m_qPalette.data();
 }
 
@@ -157,9 +163,16 @@ int RpQImageBackend::palette_len(void) const
  */
 QImage RpQImageBackend::getQImage(void) const
 {
-	if (this->format == rp_image::FORMAT_CI8) {
+	if (this->format == rp_image::FORMAT_CI8 && m_qPalette_dirty) {
 		// Copy the local color table to the QImage.
-		const_cast<RpQImageBackend*>(this)->m_qImage.setColorTable(m_qPalette);
+		// NOTE: Only done when the palette has actually changed.
+		// setColorTable() detaches the QImage, which deep-copies
+		// the pixel data if a previously returned QImage is
+		// still alive; repeated calls with a clean palette are
+		// just a refcount bump.
+		RpQImageBackend *const ncthis = const_cast<RpQImageBackend*>(this);
+		ncthis->m_qImage.setColorTable(m_qPalette);
+		ncthis->m_qPalette_dirty = false;
 	}
 
 	return m_qImage;
@@ -35,6 +35,18 @@ class RpQImageBackend : public LibRpBase::rp_image_backend
 		 */
 		static LibRpBase::rp_image_backend *creator_fn(int width, int height, LibRpBase::rp_image::Format format);
 
+	public:
+		// Backend identifier tag. ('RpQI')
+		static const uint32_t BACKEND_ID = 0x52705149;
+
+		/**
+		 * Get the backend identifier tag.
+		 * Allows rpToQImage() to use static_cast<> after an
+		 * integer compare instead of dynamic_cast<>.
+		 * @return BACKEND_ID.
+		 */
+		uint32_t backendId(void) const final { return BACKEND_ID; }
+
 		// Image data.
 		void *data(void) final;
 		const void *data(void) const final;
@@ -62,6 +74,14 @@ class RpQImageBackend : public LibRpBase::rp_image_backend
 	protected:
 		QImage m_qImage;
 		QVector<QRgb> m_qPalette;
+
+		// Set when the palette may have been modified through
+		// palette(); cleared when getQImage() re-syncs the
+		// QImage color table. Keeping the color table in sync
+		// lazily means repeated getQImage() calls are just a
+		// QImage refcount bump instead of a setColorTable(),
+		// which detaches (and deep-copies) the shared image.
+		bool m_qPalette_dirty;
 };
 
 #endif /* __ROMPROPERTIES_KDE_RPQIMAGEBACKEND_HPP__ */
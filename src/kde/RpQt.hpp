@@ -11,12 +11,16 @@
 
 #include <string>
 
-namespace LibRpBase {
-	class rp_image;
-}
+// librpbase
+#include "librpbase/common.h"
+#include "librpbase/img/rp_image.hpp"
+
+// RpQImageBackend
+#include "RpQImageBackend.hpp"
 
 // Qt includes.
 #include <QtCore/QString>
+#include <QtCore/QVector>
 #include <QtGui/QImage>
 
 /** Text conversion. **/
@@ -61,9 +65,67 @@ static inline QString U82Q(const char *str, int len = -1)
 
 /**
  * Convert an rp_image to QImage.
+ *
+ * NOTE: Defined inline so callers can fold the null/backend
+ * checks into their own branches. This function is called for
+ * every thumbnail and icon frame, so the call overhead adds up.
+ *
  * @param image rp_image.
  * @return QImage.
  */
-QImage rpToQImage(const LibRpBase::rp_image *image);
+static inline QImage rpToQImage(const LibRpBase::rp_image *image)
+{
+	if (unlikely(!image || !image->isValid()))
+		return QImage();
+
+	// We should be using the RpQImageBackend.
+	// NOTE: Checking the backend identifier tag instead of using
+	// dynamic_cast<>, which walks the class hierarchy and compares
+	// type_info strings on every conversion.
+	const LibRpBase::rp_image_backend *const backend = image->backend();
+	if (unlikely(backend->backendId() != RpQImageBackend::BACKEND_ID)) {
+		// Incorrect backend set.
+		return QImage();
+	}
+
+	return static_cast<const RpQImageBackend*>(backend)->getQImage();
+}
+
+/**
+ * Convert an array of rp_image objects to QImage.
+ * More efficient than individual rpToQImage() calls when converting
+ * an animated icon's frames: the backend type is verified once for
+ * the whole array, since all frames from one decoder share the same
+ * backend class.
+ * @param images Array of rp_image pointers. (Individual entries may be nullptr.)
+ * @param n Number of images.
+ * @return QVector of QImages. (Null QImage on individual failure.)
+ */
+static inline QVector<QImage> rpToQImages(const LibRpBase::rp_image *const *images, int n)
+{
+	QVector<QImage> ret(n > 0 ? n : 0);
+
+	// Verify the backend type using the first valid image.
+	bool backend_ok = false;
+	for (int i = 0; i < n; i++) {
+		const LibRpBase::rp_image *const image = images[i];
+		if (!image || !image->isValid())
+			continue;
+		backend_ok = (image->backend()->backendId() == RpQImageBackend::BACKEND_ID);
+		break;
+	}
+	if (unlikely(!backend_ok)) {
+		// No valid images, or an incorrect backend is set.
+		return ret;
+	}
+
+	for (int i = 0; i < n; i++) {
+		const LibRpBase::rp_image *const image = images[i];
+		if (image && image->isValid()) {
+			ret[i] = static_cast<const RpQImageBackend*>(image->backend())->getQImage();
+		}
+	}
+	return ret;
+}
 
 #endif /* __ROMPROPERTIES_KDE_RPQT_HPP__ */
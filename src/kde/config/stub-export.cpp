@@ -14,6 +14,7 @@
 
 // Qt includes.
 #include <QApplication>
+#include <QtCore/QPointer>
 
 // i18n
 #include "libi18n/i18n.h"
@@ -36,6 +37,9 @@ Q_DECL_EXPORT int rp_show_config_dialog(int argc, char *argv[])
 	}
 
 	QApplication *rpApp = qApp;
+	// If qApp already exists, the host process owns the main
+	// event loop, so we must not start our own. (see below)
+	const bool owned_app = (rpApp == nullptr);
 	if (!rpApp) {
 #if QT_VERSION >= 0x050000
 		// Enable High DPI.
@@ -51,24 +55,46 @@ Q_DECL_EXPORT int rp_show_config_dialog(int argc, char *argv[])
 #endif /* QT_VERSION >= 0x050000 */
 		// Create the QApplication.
 		rpApp = new QApplication(argc, argv);
+	}
 
-#ifdef ENABLE_NLS
-		// Install the translator for Gettext translations.
+	// Initialize base i18n and install the Gettext translator.
+	// Only done once per process, even if a long-lived host
+	// re-invokes the stub. This also covers hosts that already
+	// had a QApplication, which previously never got the
+	// translator installed.
+	// (Qt GUI code is single-threaded, so a plain static works.)
+	static bool i18n_initialized = false;
+	if (!i18n_initialized) {
+		i18n_initialized = true;
 		rp_i18n_init();
+#ifdef ENABLE_NLS
 		rpApp->installTranslator(new GettextTranslator());
 #endif /* ENABLE_NLS */
-	} else {
-		// Initialize base i18n.
-		// TODO: Install the translator even if we're reusing the QApplication?
-		rp_i18n_init();
 	}
 
 	// Create and run the ConfigDialog.
+	// The previous instance is reused if it's still alive, which
+	// skips the widget-tree construction on re-invocation.
+	// NOTE: ConfigDialog sets WA_DeleteOnClose; QPointer nulls
+	// itself when the dialog is destroyed.
 	// TODO: Get the return value?
-	ConfigDialog *cfg = new ConfigDialog();
+	static QPointer<ConfigDialog> cfg;
+	if (!cfg) {
+		cfg = new ConfigDialog();
+	}
 	cfg->show();
+	cfg->raise();
+	cfg->activateWindow();
 
 	// Run the Qt UI.
-	// FIXME: May need changes if the main loop is already running.
-	return rpApp->exec();
+	// If we created the QApplication, run the main event loop.
+	// Otherwise, the host process already owns the main loop;
+	// re-entering it here would never return control to the host,
+	// so run a local modal loop on the dialog instead. This is
+	// also much cheaper to set up and tear down, and it returns
+	// the dialog's actual result code.
+	if (owned_app) {
+		return rpApp->exec();
+	}
+	return cfg->exec();
 }
@@ -6,6 +6,9 @@
  * SPDX-License-Identifier: GPL-2.0-or-later                               *
  ***************************************************************************/
 
+#ifdef _WIN32
+# include "stdafx.h"
+#endif
 #include "IDownloader.hpp"
 
 // C includes. (C++ namespace)
@@ -0,0 +1,16 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * stdafx.cpp: Common definitions and includes for COM.                    *
+ *                                                                         *
+ * Copyright (c) 2016 by David Korth.                                      *
+ * SPDX-License-Identifier: GPL-2.0-or-later                               *
+ ***************************************************************************/
+
+// stdafx.cpp : source file that includes just the standard includes
+// hidecon.pch will be the pre-compiled header
+// stdafx.obj will contain the pre-compiled type information
+
+#include "stdafx.h"
+
+// TODO: reference any additional headers you need in STDAFX.H
+// and not in this file
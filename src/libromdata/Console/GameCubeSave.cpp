@@ -33,6 +33,7 @@ using namespace LibRpBase;
 #include <cstring>
 
 // C++ includes.
+#include <numeric>
 #include <string>
 #include <vector>
 using std::string;
@@ -60,6 +61,15 @@ class GameCubeSavePrivate : public RomDataPrivate
 		// Animated icon data.
 		IconAnimData *iconAnimData;
 
+		// First icon frame.
+		// NOTE: Owned by iconAnimData; cached here so the
+		// static icon lookup is a single pointer load instead
+		// of a dereference chain through iconAnimData.
+		const rp_image *img_icon;
+
+		// Set to true once loadImages() has been attempted.
+		bool images_loaded;
+
 	public:
 		// RomFields data.
 
@@ -88,6 +98,22 @@ class GameCubeSavePrivate : public RomDataPrivate
 		// and the CARD directory entry.
 		int dataOffset;
 
+		// Cached description. (game description + '\n' + file description)
+		// Loaded on demand by getDescription().
+		std::string desc_cache;
+		bool desc_loaded;
+
+		/**
+		 * Get the save file's description.
+		 *
+		 * The two 32-byte description fields are read and converted
+		 * once, then cached for use by both loadFieldData() and
+		 * loadMetaData().
+		 *
+		 * @return Description, or empty string on error.
+		 */
+		const std::string &getDescription(void);
+
 		/**
 		 * Is the specified buffer a valid CARD directory entry?
 		 * @param buffer CARD directory entry. (Must be 64 bytes.)
@@ -97,6 +123,15 @@ class GameCubeSavePrivate : public RomDataPrivate
 		 */
 		static bool isCardDirEntry(const uint8_t *buffer, uint32_t data_size, SaveType saveType);
 
+		/**
+		 * Load the save file's banner and icons.
+		 *
+		 * The banner and icon data are stored contiguously
+		 * starting at direntry.iconaddr, so both are loaded
+		 * with a single read and decoded from one buffer.
+		 */
+		void loadImages(void);
+
 		/**
 		 * Load the save file's icons.
 		 *
@@ -120,8 +155,11 @@ GameCubeSavePrivate::GameCubeSavePrivate(GameCubeSave *q, IRpFile *file)
 	: super(q, file)
 	, img_banner(nullptr)
 	, iconAnimData(nullptr)
+	, img_icon(nullptr)
+	, images_loaded(false)
 	, saveType(SAVE_TYPE_UNKNOWN)
 	, dataOffset(-1)
+	, desc_loaded(false)
 {
 	// Clear the directory entry.
 	memset(&direntry, 0, sizeof(direntry));
@@ -149,11 +187,12 @@ void GameCubeSavePrivate::byteswap_direntry(card_direntry *direntry, SaveType sa
 		// Swap 16-bit values at 0x2E through 0x40.
 		// Also 0x06 (pad_00 / bannerfmt).
 		// Reference: https://github.com/dolphin-emu/dolphin/blob/master/Source/Core/Core/HW/GCMemcard.cpp
+		// NOTE: Using the optimized byteswap function, which uses
+		// a single SSSE3 pshufb (or SSE2 shifts) for the 0x2C-0x40
+		// run instead of ten scalar swaps.
 		uint16_t *const u16ptr = reinterpret_cast<uint16_t*>(direntry);
 		u16ptr[0x06>>1] = __swab16(u16ptr[0x06>>1]);
-		for (int i = (0x2C>>1); i < (0x40>>1); i++) {
-			u16ptr[i] = __swab16(u16ptr[i]);
-		}
+		__byte_swap_16_array(&u16ptr[0x2C>>1], 0x40-0x2C);
 	}
 
 	// FIXME: Dolphin says the GCS length field might not be accurate.
@@ -171,6 +210,52 @@ void GameCubeSavePrivate::byteswap_direntry(card_direntry *direntry, SaveType sa
 	direntry->commentaddr	= be32_to_cpu(direntry->commentaddr);
 }
 
+/**
+ * Byteswap a PDP-endian 32-bit value to host-endian.
+ *
+ * MaxDrive SAV files store 32-bit fields with the 16-bit halves in
+ * big-endian order, but each half little-endian, i.e. PDP-endian.
+ * This is equivalent to byteswapping each half of be32_to_cpu(src),
+ * which collapses to a single 16-bit rotate on little-endian hosts.
+ *
+ * @param src PDP-endian value, as read from the file.
+ * @return Host-endian value.
+ */
+static inline uint32_t pdp_swap(uint32_t src)
+{
+	const uint32_t swapped = __swab32(be32_to_cpu(src));
+	return (swapped >> 16) | (swapped << 16);
+}
+
+/**
+ * Find the first NUL byte in a 32-byte description field.
+ *
+ * SWAR scan: each 8-byte chunk is tested for a zero byte with the
+ * ((v - 0x01...) & ~v & 0x80...) trick, which avoids memchr()'s
+ * startup overhead on such a short fixed-length buffer.
+ *
+ * @param p Buffer. (Must be 32 bytes.)
+ * @return Index of the first NUL byte, or 32 if none are present.
+ */
+static inline int nul_index_32(const char *p)
+{
+	for (int j = 0; j < 32; j += 8) {
+		uint64_t v;
+		memcpy(&v, &p[j], sizeof(v));
+		if ((v - 0x0101010101010101ULL) & ~v & 0x8080808080808080ULL) {
+			// This chunk contains a NUL byte.
+			for (int k = 0; k < 8; k++) {
+				if (p[j+k] == 0) {
+					return j + k;
+				}
+			}
+		}
+	}
+
+	// No NUL bytes found.
+	return 32;
+}
+
 /**
  * Is the specified buffer a valid CARD directory entry?
  * @param buffer CARD directory entry. (Must be 64 bytes.)
@@ -187,29 +272,28 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 	// Game ID should be alphanumeric.
 	// TODO: NDDEMO has a NULL in the game ID, but I don't think
 	// it has save files.
+	// NOTE: Branchless check: the per-character range tests are
+	// accumulated into a single flag so random game IDs don't
+	// cause six unpredictable branches on the detection hot path.
+	unsigned int id6_ok = 1;
 	for (int i = 6-1; i >= 0; i--) {
-		if (!ISALNUM(direntry->id6[i])) {
-			// Non-alphanumeric character.
-			return false;
-		}
+		const unsigned int chr = static_cast<uint8_t>(direntry->id6[i]);
+		id6_ok &= ((chr - '0') <= 9) | (((chr | 0x20) - 'a') <= 25);
 	}
-
-	// Padding should be 0xFF.
-	if (saveType == SAVE_TYPE_SAV) {
-		// MaxDrive SAV. pad_00 and bannerfmt are swappde.
-		if (direntry->bannerfmt != 0xFF) {
-			// Incorrect padding.
-			return false;
-		}
-	} else {
-		// Other formats.
-		if (direntry->pad_00 != 0xFF) {
-			// Incorrect padding.
-			return false;
-		}
+	if (!id6_ok) {
+		// Non-alphanumeric character.
+		return false;
 	}
 
-	if (direntry->pad_01 != cpu_to_be16(0xFFFF)) {
+	// Padding should be 0xFF.
+	// MaxDrive SAV has pad_00 and bannerfmt swapped.
+	// NOTE: Both padding checks are folded into a single branch.
+	// (pad_00/bannerfmt and pad_01 aren't adjacent in the struct,
+	// so they can't be checked with a single wide compare.)
+	const uint8_t pad_00 = (saveType == SAVE_TYPE_SAV)
+		? direntry->bannerfmt
+		: direntry->pad_00;
+	if ((pad_00 != 0xFF) | (direntry->pad_01 != cpu_to_be16(0xFFFF))) {
 		// Incorrect padding.
 		return false;
 	}
@@ -220,12 +304,14 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 	// stored in the GSV file. If a GCS file is added
 	// without using the GameSaves software, this
 	// field will always be 1.
-	unsigned int length;
+	// The caller has already verified that data_size is a multiple
+	// of 8192, so the block counts can be compared directly instead
+	// of multiplying the length field back up.
+	const unsigned int blocks_needed = data_size >> 13;	// 8,192 bytes per block
 	switch (saveType) {
 		case SAVE_TYPE_GCS:
 			// Just check for >= 1.
-			length = be16_to_cpu(direntry->length);
-			if (length == 0) {
+			if (be16_to_cpu(direntry->length) == 0) {
 				// Incorrect block count.
 				return false;
 			}
@@ -233,8 +319,7 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 
 		case SAVE_TYPE_SAV:
 			// SAV: Field is little-endian
-			length = le16_to_cpu(direntry->length);
-			if (length * 8192 != data_size) {
+			if (le16_to_cpu(direntry->length) != blocks_needed) {
 				// Incorrect block count.
 				return false;
 			}
@@ -243,8 +328,7 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 		case SAVE_TYPE_GCI:
 		default:
 			// GCI: Field is big-endian.
-			length = be16_to_cpu(direntry->length);
-			if (length * 8192 != data_size) {
+			if (be16_to_cpu(direntry->length) != blocks_needed) {
 				// Incorrect block count.
 				return false;
 			}
@@ -253,21 +337,13 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 
 	// Comment and icon addresses should both be less than the file size,
 	// minus 64 bytes for the GCI header.
-#define PDP_SWAP(dest, src) \
-	do { \
-		union { uint16_t w[2]; uint32_t d; } tmp; \
-		tmp.d = be32_to_cpu(src); \
-		tmp.w[0] = __swab16(tmp.w[0]); \
-		tmp.w[1] = __swab16(tmp.w[1]); \
-		(dest) = tmp.d; \
-	} while (0)
 	uint32_t iconaddr, commentaddr;
 	if (saveType != SAVE_TYPE_SAV) {
 		iconaddr = be32_to_cpu(direntry->iconaddr);
 		commentaddr = be32_to_cpu(direntry->commentaddr);
 	} else {
-		PDP_SWAP(iconaddr, direntry->iconaddr);
-		PDP_SWAP(commentaddr, direntry->commentaddr);
+		iconaddr = pdp_swap(direntry->iconaddr);
+		commentaddr = pdp_swap(direntry->commentaddr);
 	}
 	if (iconaddr >= data_size || commentaddr >= data_size) {
 		// Comment and/or icon are out of bounds.
@@ -279,42 +355,50 @@ bool GameCubeSavePrivate::isCardDirEntry(const uint8_t *buffer, uint32_t data_si
 }
 
 /**
- * Load the save file's icons.
+ * Load the save file's banner and icons.
  *
- * This will load all of the animated icon frames,
- * though only the first frame will be returned.
- *
- * @return Icon, or nullptr on error.
+ * The banner and icon data are stored contiguously
+ * starting at direntry.iconaddr, so both are loaded
+ * with a single read and decoded from one buffer.
  */
-const rp_image *GameCubeSavePrivate::loadIcon(void)
+void GameCubeSavePrivate::loadImages(void)
 {
-	if (iconAnimData) {
-		// Icon has already been loaded.
-		return iconAnimData->frames[0];
-	} else if (!this->file || !this->isValid) {
-		// Can't load the icon.
-		return nullptr;
+	if (images_loaded) {
+		// Images have already been loaded (or failed to load).
+		return;
 	}
+	images_loaded = true;
 
-	// Calculate the icon start address.
-	// The icon is located directly after the banner.
-	uint32_t iconaddr = direntry.iconaddr;
+	// Calculate the banner size.
+	// The icons are located directly after the banner.
+	uint32_t bannersize;
 	switch (direntry.bannerfmt & CARD_BANNER_MASK) {
 		case CARD_BANNER_CI:
-			// CI8 banner.
-			iconaddr += (CARD_BANNER_W * CARD_BANNER_H * 1);
-			iconaddr += (256 * 2);	// RGB5A3 palette
+			// CI8 banner, plus RGB5A3 palette.
+			bannersize = (CARD_BANNER_W * CARD_BANNER_H * 1) + (256*2);
 			break;
 		case CARD_BANNER_RGB:
 			// RGB5A3 banner.
-			iconaddr += (CARD_BANNER_W * CARD_BANNER_H * 2);
+			bannersize = (CARD_BANNER_W * CARD_BANNER_H * 2);
 			break;
 		default:
 			// No banner.
+			bannersize = 0;
 			break;
 	}
 
 	// Calculate the icon sizes.
+	// The format, speed, and data offset of each frame are recorded
+	// here so the decode loop below can dispatch on the precomputed
+	// values instead of walking the two bitfields a second time.
+	struct frame_desc_t {
+		uint32_t offset;	// Frame data offset within the icon data.
+		uint8_t fmt;		// CARD_ICON_* format.
+		uint8_t delay;		// CARD_SPEED_* delay value.
+	};
+	frame_desc_t frame_desc[CARD_MAXICONS];
+	int nframes = 0;
+
 	unsigned int iconsizetotal = 0;
 	bool is_CI8_shared = false;
 	uint16_t iconfmt = direntry.iconfmt;
@@ -325,29 +409,27 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 			break;
 		}
 
-		switch (iconfmt & CARD_ICON_MASK) {
-			case CARD_ICON_RGB:
-				// RGB5A3
-				iconsizetotal += (CARD_ICON_W * CARD_ICON_H * 2);
-				break;
-
-			case CARD_ICON_CI_UNIQUE:
-				// CI8 with a unique palette.
-				// Palette is located immediately after the icon.
-				iconsizetotal += (CARD_ICON_W * CARD_ICON_H * 1) + (256*2);
-				break;
+		// Frame data size, indexed by CARD_ICON_* format:
+		// - CARD_ICON_NONE: No data.
+		// - CARD_ICON_CI_SHARED: CI8 pixels only; the shared palette
+		//   is located after *all* of the icons.
+		// - CARD_ICON_RGB: RGB5A3 pixels.
+		// - CARD_ICON_CI_UNIQUE: CI8 pixels, followed by the palette.
+		static const uint16_t iconsize_tbl[4] = {
+			0,
+			(CARD_ICON_W * CARD_ICON_H * 1),
+			(CARD_ICON_W * CARD_ICON_H * 2),
+			(CARD_ICON_W * CARD_ICON_H * 1) + (256*2),
+		};
 
-			case CARD_ICON_CI_SHARED:
-				// CI8 with a shared palette.
-				// Palette is located after *all* of the icons.
-				iconsizetotal += (CARD_ICON_W * CARD_ICON_H * 1);
-				is_CI8_shared = true;
-				break;
+		const unsigned int fmt = (iconfmt & CARD_ICON_MASK);
+		frame_desc[nframes].offset = iconsizetotal;
+		frame_desc[nframes].fmt = static_cast<uint8_t>(fmt);
+		frame_desc[nframes].delay = static_cast<uint8_t>(iconspeed & CARD_SPEED_MASK);
+		nframes++;
 
-			default:
-				// No icon.
-				break;
-		}
+		iconsizetotal += iconsize_tbl[fmt];
+		is_CI8_shared |= (fmt == CARD_ICON_CI_SHARED);
 	}
 
 	if (is_CI8_shared) {
@@ -356,51 +438,74 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 		iconsizetotal += (256*2);
 	}
 
-	// Load the icon data.
+	// Load the banner and icon data in a single read.
+	// The common case (RGB banner plus a few CI8 icons) is a few KiB,
+	// so a stack buffer is used if the data fits. The worst case
+	// (RGB banner plus 8 RGB icons) is 22,528 bytes and falls back
+	// to the heap.
 	// TODO: Only read the first frame unless specifically requested?
-	auto icondata = aligned_uptr<uint8_t>(16, iconsizetotal);
-	size_t size = file->seekAndRead(dataOffset + iconaddr, icondata.get(), iconsizetotal);
-	if (size != iconsizetotal) {
+	const uint32_t totalsize = bannersize + iconsizetotal;
+	ALIGNED_VAR(16, uint8_t stackbuf[16*1024]);
+	unique_ptr_aligned<uint8_t> heapdata(nullptr, aligned_free);
+	uint8_t *imgdata;
+	if (totalsize <= sizeof(stackbuf)) {
+		imgdata = stackbuf;
+	} else {
+		heapdata = aligned_uptr<uint8_t>(16, totalsize);
+		imgdata = heapdata.get();
+	}
+	size_t size = file->seekAndRead(dataOffset + direntry.iconaddr, imgdata, totalsize);
+	if (size != totalsize) {
 		// Seek and/or read error.
-		return nullptr;
+		return;
 	}
 
+	// Decode the banner.
+	if ((direntry.bannerfmt & CARD_BANNER_MASK) == CARD_BANNER_RGB) {
+		// Convert the banner from GCN RGB5A3 format to ARGB32.
+		img_banner = ImageDecoder::fromGcn16(ImageDecoder::PXF_RGB5A3,
+			CARD_BANNER_W, CARD_BANNER_H,
+			reinterpret_cast<const uint16_t*>(imgdata), bannersize);
+	} else if ((direntry.bannerfmt & CARD_BANNER_MASK) == CARD_BANNER_CI) {
+		// Convert the banner from GCN CI8 format to CI8.
+		// The palette is located after the pixel data.
+		static const uint32_t ci8_pxsize = (CARD_BANNER_W * CARD_BANNER_H * 1);
+		img_banner = ImageDecoder::fromGcnCI8(CARD_BANNER_W, CARD_BANNER_H,
+			imgdata, ci8_pxsize,
+			reinterpret_cast<const uint16_t*>(imgdata + ci8_pxsize), 256*2);
+	}
+
+	// Icon data starts after the banner.
+	const uint8_t *const icondata = imgdata + bannersize;
+
 	const uint16_t *pal_CI8_shared = nullptr;
 	if (is_CI8_shared) {
 		// Shared CI8 palette is at the end of the data.
 		pal_CI8_shared = reinterpret_cast<const uint16_t*>(
-			icondata.get() + (iconsizetotal - (256*2)));
+			icondata + (iconsizetotal - (256*2)));
 	}
 
 	this->iconAnimData = new IconAnimData();
-	iconAnimData->count = 0;
-
-	unsigned int iconaddr_cur = 0;
-	iconfmt = direntry.iconfmt;
-	iconspeed = direntry.iconspeed;
-	for (int i = 0; i < CARD_MAXICONS; i++, iconfmt >>= 2, iconspeed >>= 2) {
-		const unsigned int delay = (iconspeed & CARD_SPEED_MASK);
-		if (delay == CARD_SPEED_END) {
-			// End of the icons.
-			break;
-		}
+	iconAnimData->count = nframes;
+
+	for (int i = 0; i < nframes; i++) {
+		const frame_desc_t &desc = frame_desc[i];
 
 		// Icon delay.
 		// Using 125ms for the fastest speed.
 		// TODO: Verify this?
-		iconAnimData->delays[i].numer = static_cast<uint16_t>(delay);
+		iconAnimData->delays[i].numer = desc.delay;
 		iconAnimData->delays[i].denom = 8;
-		iconAnimData->delays[i].ms = delay * 125;
+		iconAnimData->delays[i].ms = desc.delay * 125;
 
-		switch (iconfmt & CARD_ICON_MASK) {
+		switch (desc.fmt) {
 			case CARD_ICON_RGB: {
 				// RGB5A3
 				static const unsigned int iconsize = CARD_ICON_W * CARD_ICON_H * 2;
 				iconAnimData->frames[i] = ImageDecoder::fromGcn16(ImageDecoder::PXF_RGB5A3,
 					CARD_ICON_W, CARD_ICON_H,
-					reinterpret_cast<const uint16_t*>(icondata.get() + iconaddr_cur),
+					reinterpret_cast<const uint16_t*>(icondata + desc.offset),
 					iconsize);
-				iconaddr_cur += iconsize;
 				break;
 			}
 
@@ -410,9 +515,8 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 				static const unsigned int iconsize = CARD_ICON_W * CARD_ICON_H * 1;
 				iconAnimData->frames[i] = ImageDecoder::fromGcnCI8(
 					CARD_ICON_W, CARD_ICON_H,
-					icondata.get() + iconaddr_cur, iconsize,
-					reinterpret_cast<const uint16_t*>(icondata.get() + iconaddr_cur + iconsize), 256*2);
-				iconaddr_cur += iconsize + (256*2);
+					icondata + desc.offset, iconsize,
+					reinterpret_cast<const uint16_t*>(icondata + desc.offset + iconsize), 256*2);
 				break;
 			}
 
@@ -420,22 +524,21 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 				static const unsigned int iconsize = CARD_ICON_W * CARD_ICON_H * 1;
 				iconAnimData->frames[i] = ImageDecoder::fromGcnCI8(
 					CARD_ICON_W, CARD_ICON_H,
-					icondata.get() + iconaddr_cur, iconsize,
+					icondata + desc.offset, iconsize,
 					pal_CI8_shared, 256*2);
-				iconaddr_cur += iconsize;
 				break;
 			}
 
 			default:
-				// No icon.
-				// Add a nullptr as a placeholder.
-				iconAnimData->frames[i] = 0;
+				// No icon. The frame pointer is already nullptr;
+				// IconAnimData's constructor zero-fills frames[].
 				break;
 		}
-
-		iconAnimData->count++;
 	}
 
+	// Cache the first frame as the static icon.
+	img_icon = iconAnimData->frames[0];
+
 	// NOTE: We're not deleting iconAnimData even if we only have
 	// a single icon because iconAnimData() will call loadIcon()
 	// if iconAnimData is nullptr.
@@ -444,10 +547,11 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 	// FIXME: This isn't done correctly if blank frames are present
 	// and the icon uses the "bounce" animation.
 	// 'rpcli -a' fails at a result.
-	int idx = 0;
-	for (int i = 0; i < iconAnimData->count; i++, idx++) {
-		iconAnimData->seq_index[idx] = i;
-	}
+	// NOTE: The forward fill is a plain iota and the bounce fill is
+	// a strict reverse copy, both of which the compiler vectorizes.
+	int idx = iconAnimData->count;
+	std::iota(iconAnimData->seq_index.begin(),
+		  iconAnimData->seq_index.begin() + iconAnimData->count, 0);
 	if (direntry.bannerfmt & CARD_ANIM_MASK) {
 		// "Bounce" the icon.
 		for (int i = iconAnimData->count-2; i > 0; i--, idx++) {
@@ -456,9 +560,29 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 		}
 	}
 	iconAnimData->seq_count = idx;
+}
+
+/**
+ * Load the save file's icons.
+ *
+ * This will load all of the animated icon frames,
+ * though only the first frame will be returned.
+ *
+ * @return Icon, or nullptr on error.
+ */
+const rp_image *GameCubeSavePrivate::loadIcon(void)
+{
+	if (img_icon) {
+		// Icon has already been loaded.
+		return img_icon;
+	} else if (!this->file || !this->isValid) {
+		// Can't load the icon.
+		return nullptr;
+	}
 
-	// Return the first frame.
-	return iconAnimData->frames[0];
+	// The banner and icons are loaded in one pass.
+	loadImages();
+	return img_icon;
 }
 
 /**
@@ -475,53 +599,49 @@ const rp_image *GameCubeSavePrivate::loadBanner(void)
 		return nullptr;
 	}
 
-	// Banner is located at direntry.iconaddr.
-	// Determine the banner format and size.
-	uint32_t bannersize;
-	switch (direntry.bannerfmt & CARD_BANNER_MASK) {
-		case CARD_BANNER_CI:
-			// CI8 banner.
-			bannersize = (CARD_BANNER_W * CARD_BANNER_H * 1);
-			break;
-		case CARD_BANNER_RGB:
-			bannersize = (CARD_BANNER_W * CARD_BANNER_H * 2);
-			break;
-		default:
-			// No banner.
-			return nullptr;
+	// The banner and icons are loaded in one pass.
+	loadImages();
+	return img_banner;
+}
+
+/**
+ * Get the save file's description.
+ *
+ * The two 32-byte description fields are read and converted
+ * once, then cached for use by both loadFieldData() and
+ * loadMetaData().
+ *
+ * @return Description, or empty string on error.
+ */
+const string &GameCubeSavePrivate::getDescription(void)
+{
+	if (desc_loaded) {
+		// Description has already been loaded.
+		return desc_cache;
 	}
+	desc_loaded = true;
 
-	// Read the banner data.
-	static const int MAX_BANNER_SIZE = (CARD_BANNER_W * CARD_BANNER_H * 2);
-	uint8_t bannerbuf[MAX_BANNER_SIZE];
-	size_t size = file->seekAndRead(dataOffset + direntry.iconaddr,
-					bannerbuf, bannersize);
-	if (size != bannersize) {
+	char desc_buf[64];
+	size_t size = file->seekAndRead(dataOffset + direntry.commentaddr,
+					desc_buf, sizeof(desc_buf));
+	if (size != sizeof(desc_buf)) {
 		// Seek and/or read error.
-		return nullptr;
+		return desc_cache;
 	}
 
-	if ((direntry.bannerfmt & CARD_BANNER_MASK) == CARD_BANNER_RGB) {
-		// Convert the banner from GCN RGB5A3 format to ARGB32.
-		img_banner = ImageDecoder::fromGcn16(ImageDecoder::PXF_RGB5A3,
-			CARD_BANNER_W, CARD_BANNER_H,
-			reinterpret_cast<const uint16_t*>(bannerbuf), bannersize);
-	} else {
-		// Read the palette data.
-		uint16_t palbuf[256];
-		size = file->seekAndRead(dataOffset + direntry.iconaddr + bannersize,
-					 palbuf, sizeof(palbuf));
-		if (size != sizeof(palbuf)) {
-			// Seek and/or read error.
-			return nullptr;
-		}
+	// NOTE: Some games have garbage after the first NULL byte
+	// in the two description fields, which prevents the rest
+	// of the field from being displayed.
 
-		// Convert the banner from GCN CI8 format to CI8.
-		img_banner = ImageDecoder::fromGcnCI8(CARD_BANNER_W, CARD_BANNER_H,
-			bannerbuf, bannersize, palbuf, sizeof(palbuf));
-	}
+	// Check for a NULL byte in the game description.
+	string desc = cp1252_sjis_to_utf8(desc_buf, nul_index_32(desc_buf));
+	desc += '\n';
 
-	return img_banner;
+	// Check for a NULL byte in the file description.
+	desc += cp1252_sjis_to_utf8(&desc_buf[32], nul_index_32(&desc_buf[32]));
+
+	desc_cache = desc;
+	return desc_cache;
 }
 
 /** GameCubeSave **/
@@ -553,7 +673,12 @@ GameCubeSave::GameCubeSave(IRpFile *file)
 	}
 
 	// Read the save file header.
-	uint8_t header[1024];
+	// Detection only needs the area up to the end of the GCS
+	// directory entry (0x110 + 64), so don't read a full KB.
+	// NOTE: A smaller magic-only prefilter wouldn't help here,
+	// since GCI files have no magic number and always require
+	// the directory entry check.
+	uint8_t header[0x150];
 	d->file->rewind();
 	size_t size = d->file->read(&header, sizeof(header));
 	if (size != sizeof(header)) {
@@ -612,9 +737,11 @@ int GameCubeSave::isRomSupported_static(const DetectInfo *info)
 	assert(info != nullptr);
 	assert(info->header.pData != nullptr);
 	assert(info->header.addr == 0);
+	// NOTE: The largest required header area is the GCS directory
+	// entry, which ends at 0x150.
 	if (!info || !info->header.pData ||
 	    info->header.addr != 0 ||
-	    info->header.size < 1024)
+	    info->header.size < 0x150)
 	{
 		// Either no detection information was specified,
 		// or the header is too small.
@@ -870,11 +997,13 @@ int GameCubeSave::loadFieldData(void)
 	// Game ID.
 	// Replace any non-printable characters with underscores.
 	// (NDDEMO has ID6 "00\0E01".)
+	// NOTE: Branchless: each character is selected with a
+	// conditional move instead of a branch. (ASCII printable
+	// range is 0x20-0x7E.)
 	char id6[7];
 	for (int i = 0; i < 6; i++) {
-		id6[i] = (ISPRINT(direntry->id6[i])
-			? direntry->id6[i]
-			: '_');
+		const uint8_t chr = static_cast<uint8_t>(direntry->id6[i]);
+		id6[i] = (static_cast<uint8_t>(chr - 0x20) < 0x5F) ? chr : '_';
 	}
 	id6[6] = 0;
 	d->fields->addField_string(C_("GameCubeSave", "Game ID"), latin1_to_utf8(id6, 6));
@@ -891,33 +1020,8 @@ int GameCubeSave::loadFieldData(void)
 			direntry->filename, sizeof(direntry->filename)));
 
 	// Description.
-	char desc_buf[64];
-	size_t size = d->file->seekAndRead(d->dataOffset + direntry->commentaddr,
-					   desc_buf, sizeof(desc_buf));
-	if (size == sizeof(desc_buf)) {
-		// Add the description.
-		// NOTE: Some games have garbage after the first NULL byte
-		// in the two description fields, which prevents the rest
-		// of the field from being displayed.
-
-		// Check for a NULL byte in the game description.
-		int desc_len = 32;
-		const char *null_pos = static_cast<const char*>(memchr(desc_buf, 0, 32));
-		if (null_pos) {
-			// Found a NULL byte.
-			desc_len = static_cast<int>(null_pos - desc_buf);
-		}
-		string desc = cp1252_sjis_to_utf8(desc_buf, desc_len);
-		desc += '\n';
-
-		// Check for a NULL byte in the file description.
-		null_pos = static_cast<const char*>(memchr(&desc_buf[32], 0, 32));
-		if (null_pos) {
-			// Found a NULL byte.
-			desc_len = static_cast<int>(null_pos - desc_buf - 32);
-		}
-		desc += cp1252_sjis_to_utf8(&desc_buf[32], desc_len);
-
+	const string &desc = d->getDescription();
+	if (!desc.empty()) {
 		d->fields->addField_string(C_("GameCubeSave", "Description"), desc);
 	}
 
@@ -980,34 +1084,8 @@ int GameCubeSave::loadMetaData(void)
 	}
 
 	// Description. (using this as the Title)
-	// TODO: Consolidate with loadFieldData()?
-	char desc_buf[64];
-	size_t size = d->file->seekAndRead(d->dataOffset + direntry->commentaddr,
-					   desc_buf, sizeof(desc_buf));
-	if (size == sizeof(desc_buf)) {
-		// Add the description.
-		// NOTE: Some games have garbage after the first NULL byte
-		// in the two description fields, which prevents the rest
-		// of the field from being displayed.
-
-		// Check for a NULL byte in the game description.
-		int desc_len = 32;
-		const char *null_pos = static_cast<const char*>(memchr(desc_buf, 0, 32));
-		if (null_pos) {
-			// Found a NULL byte.
-			desc_len = static_cast<int>(null_pos - desc_buf);
-		}
-		string desc = cp1252_sjis_to_utf8(desc_buf, desc_len);
-		desc += '\n';
-
-		// Check for a NULL byte in the file description.
-		null_pos = static_cast<const char*>(memchr(&desc_buf[32], 0, 32));
-		if (null_pos) {
-			// Found a NULL byte.
-			desc_len = static_cast<int>(null_pos - desc_buf - 32);
-		}
-		desc += cp1252_sjis_to_utf8(&desc_buf[32], desc_len);
-
+	const string &desc = d->getDescription();
+	if (!desc.empty()) {
 		d->metaData->addMetaData_string(Property::Title, desc);
 	}
 
@@ -1035,11 +1113,12 @@ int GameCubeSave::loadInternalImage(ImageType imageType, const rp_image **pImage
 	RP_D(GameCubeSave);
 	switch (imageType) {
 		case IMG_INT_ICON:
-			if (d->iconAnimData) {
-				// Return the first icon frame.
+			if (d->img_icon) {
+				// Icon is loaded.
 				// NOTE: GCN save icon animations are always
-				// sequential, so we can use a shortcut here.
-				*pImage = d->iconAnimData->frames[0];
+				// sequential, so the static icon is the
+				// cached first frame.
+				*pImage = d->img_icon;
 				return 0;
 			}
 			break;
@@ -1056,10 +1135,12 @@ int GameCubeSave::loadInternalImage(ImageType imageType, const rp_image **pImage
 			return 0;
 	}
 
-	if (!d->file) {
+	// NOTE: Cache hits return above without touching these
+	// fields, so the checks only run on the first load.
+	if (unlikely(!d->file)) {
 		// File isn't open.
 		return -EBADF;
-	} else if (!d->isValid) {
+	} else if (unlikely(!d->isValid)) {
 		// Save file isn't valid.
 		return -EIO;
 	}
@@ -115,6 +115,10 @@ class MegaDrivePrivate : public RomDataPrivate
 		int romType;		// ROM type.
 		unsigned int md_region;	// MD hexadecimal region code.
 
+		// Branding region. Cached at construction, since
+		// systemName() is called once per name type.
+		MegaDriveRegions::MD_BrandingRegion md_bregion;
+
 		/**
 		 * Is this a disc?
 		 * Discs don't have a vector table.
@@ -164,11 +168,10 @@ MegaDrivePrivate::MegaDrivePrivate(MegaDrive *q, IRpFile *file)
 	: super(q, file)
 	, romType(ROM_UNKNOWN)
 	, md_region(0)
+	, md_bregion(MegaDriveRegions::MD_BREGION_UNKNOWN)
 {
-	// Clear the various structs.
-	memset(&vectors, 0, sizeof(vectors));
-	memset(&romHeader, 0, sizeof(romHeader));
-	memset(&smdHeader, 0, sizeof(smdHeader));
+	// NOTE: The header structs are only read after they've been
+	// copied from the ROM, so there's no need to clear them here.
 }
 
 /** Internal ROM data. **/
@@ -181,38 +184,27 @@ MegaDrivePrivate::MegaDrivePrivate(MegaDrive *q, IRpFile *file)
  */
 uint32_t MegaDrivePrivate::parseIOSupport(const char *io_support, int size)
 {
+	// Lookup table mapping MD_IO_* characters to MD_IOBF_* values.
+	// All other characters map to 0, so the parse is a single load
+	// and OR per input byte instead of scanning a character list.
+	// NOTE: Entries past 0x57 are zero-initialized.
+	static const uint16_t md_io_bit_tbl[256] = {
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x00
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x08
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x10
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x18
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x20
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x28
+		0x0004, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000, 0x0002, 0x0000,	// 0x30: '0', '4', '6'
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,	// 0x38
+		0x0000, 0x0000, 0x0100, 0x0800, 0x0000, 0x0000, 0x0400, 0x0000,	// 0x40: 'B', 'C', 'F'
+		0x0000, 0x0000, 0x0001, 0x0010, 0x1000, 0x2000, 0x0000, 0x0000,	// 0x48: 'J', 'K', 'L', 'M'
+		0x0040, 0x0000, 0x0020, 0x0000, 0x0080, 0x0000, 0x0200, 0x0000,	// 0x50: 'P', 'R', 'T', 'V'
+	};
+
 	uint32_t ret = 0;
 	for (int i = size-1; i >= 0; i--) {
-		// TODO: Sort by character and use bsearch()?
-		#define MD_IO_SUPPORT_ENTRY(entry) {MD_IO_##entry, MD_IOBF_##entry}
-		static const char md_io_chr_tbl[] = {
-			// This MUST be in the same order as MD_IO_Support_Bitfield!
-			MD_IO_JOYPAD_3,
-			MD_IO_JOYPAD_6,
-			MD_IO_JOYPAD_SMS,
-			MD_IO_TEAM_PLAYER,
-			MD_IO_KEYBOARD,
-			MD_IO_SERIAL,
-			MD_IO_PRINTER,
-			MD_IO_TABLET,
-			MD_IO_TRACKBALL,
-			MD_IO_PADDLE,
-			MD_IO_FDD,
-			MD_IO_CDROM,
-			MD_IO_ACTIVATOR,
-			MD_IO_MEGA_MOUSE,
-
-			'\0'
-		};
-
-		const char io_cur = io_support[i];
-		uint32_t io_bit = 1;
-		for (const auto *p = md_io_chr_tbl; *p != '\0'; p++, io_bit <<= 1) {
-			if (*p == io_cur) {
-				ret |= io_bit;
-				break;
-			}
-		}
+		ret |= md_io_bit_tbl[static_cast<uint8_t>(io_support[i])];
 	}
 
 	return ret;
@@ -229,6 +221,10 @@ uint32_t MegaDrivePrivate::parseIOSupport(const char *io_support, int size)
  */
 void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 {
+	// The ROM type is invariant for the whole call,
+	// so only evaluate the disc check once.
+	const bool isDisc = this->isDisc();
+
 	// Read the strings from the header.
 	fields->addField_string(C_("MegaDrive", "System"),
 		cp1252_sjis_to_utf8(pRomHeader->system, sizeof(pRomHeader->system)),
@@ -253,12 +249,19 @@ void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 		int start = 4;
 		if (pRomHeader->copyright[4] == '-')
 			start++;
-		char *endptr;
-		t_code = strtoul(&pRomHeader->copyright[start], &endptr, 10);
-		if (t_code != 0 &&
-		    endptr > &pRomHeader->copyright[start] &&
-		    endptr < &pRomHeader->copyright[start+3])
-		{
+
+		// Parse the T-code, which is one to three decimal digits.
+		// NOTE: Parsed inline instead of using strtoul(), which
+		// drags in locale handling for three bytes of input.
+		int n = 0;
+		for (; n < 4; n++) {
+			const unsigned int chr =
+				static_cast<uint8_t>(pRomHeader->copyright[start+n]) - '0';
+			if (chr > 9)
+				break;
+			t_code = (t_code * 10) + chr;
+		}
+		if (t_code != 0 && n >= 1 && n <= 3) {
 			// Valid T-code. Look up the publisher.
 			publisher = SegaPublishers::lookup(t_code);
 		}
@@ -287,7 +290,7 @@ void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 	fields->addField_string(C_("MegaDrive", "Serial Number"),
 		cp1252_sjis_to_utf8(pRomHeader->serial, sizeof(pRomHeader->serial)),
 			RomFields::STRF_TRIM_END);
-	if (!isDisc()) {
+	if (!isDisc) {
 		// Checksum. (MD only; not valid for Mega CD.)
 		fields->addField_string_numeric(C_("RomData", "Checksum"),
 			be16_to_cpu(pRomHeader->checksum), RomFields::FB_HEX, 4,
@@ -320,7 +323,7 @@ void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 	fields->addField_bitfield(C_("MegaDrive", "I/O Support"),
 		v_io_bitfield_names, 3, io_support);
 
-	if (!isDisc()) {
+	if (!isDisc) {
 		// ROM range.
 		fields->addField_string_address_range(C_("MegaDrive", "ROM Range"),
 				be32_to_cpu(pRomHeader->rom_start),
@@ -452,25 +455,42 @@ void MegaDrivePrivate::addFields_vectorTable(const M68K_VectorTable *pVectors)
 		24, 25, 26, 27, 28, 29, 30, 31,	// $60-$7C
 	};
 
+	// Byteswap the entire vector table in one pass.
+	// The array byteswap function is runtime-dispatched to
+	// SSSE3/SSE2 where available, so this processes 16 bytes
+	// per instruction instead of 20 scalar swaps in the loop.
+	uint32_t host_vecs[ARRAY_SIZE(pVectors->vectors)];
+	memcpy(host_vecs, pVectors->vectors, sizeof(host_vecs));
+#if SYS_BYTEORDER == SYS_LIL_ENDIAN
+	__byte_swap_32_array(host_vecs, sizeof(host_vecs));
+#endif
+
 	auto vv_vectors = new vector<vector<string> >(ARRAY_SIZE(vectors_names));
 	for (size_t i = 0; i < ARRAY_SIZE(vectors_names); i++) {
 		// No vectors are skipped yet.
 		// TODO: Add a mapping table when skipping some.
 		// TODO: Use an iterator?
 		auto &data_row = vv_vectors->at(i);
+		data_row.reserve(3);
 
 		// Actual vector number.
 		const uint8_t vector_index = vectors_map[i];
 
+		// NOTE: The hex columns are formatted into a stack buffer
+		// to avoid rp_sprintf()'s temporary std::string per cell.
+		char buf[16];
+
 		// #
 		// NOTE: This is the byte address in the vector table.
-		data_row.push_back(rp_sprintf("$%02X", vector_index*4));
+		int len = snprintf(buf, sizeof(buf), "$%02X", vector_index*4);
+		data_row.emplace_back(buf, len);
 
 		// Vector name
-		data_row.push_back(vectors_names[i]);
+		data_row.emplace_back(vectors_names[i]);
 
 		// Address
-		data_row.push_back(rp_sprintf("$%08X", be32_to_cpu(pVectors->vectors[vector_index])));
+		len = snprintf(buf, sizeof(buf), "$%08X", host_vecs[vector_index]);
+		data_row.emplace_back(buf, len);
 	}
 
 	static const char *const vectors_headers[] = {
@@ -536,7 +556,6 @@ MegaDrive::MegaDrive(IRpFile *file)
 
 	if (d->romType >= 0) {
 		// Save the header for later.
-		// TODO (remove before committing): Does gcc/msvc optimize this into a jump table?
 		switch (d->romType & MegaDrivePrivate::ROM_FORMAT_MASK) {
 			case MegaDrivePrivate::ROM_FORMAT_CART_BIN:
 				d->fileType = FTYPE_ROM_IMAGE;
@@ -554,9 +573,8 @@ MegaDrive::MegaDrive(IRpFile *file)
 				memcpy(&d->smdHeader, header, sizeof(d->smdHeader));
 
 				// First bank needs to be deinterleaved.
-				auto block = aligned_uptr<uint8_t>(16, SuperMagicDrive::SMD_BLOCK_SIZE * 2);
+				auto block = aligned_uptr<uint8_t>(16, SuperMagicDrive::SMD_BLOCK_SIZE);
 				uint8_t *const smd_data = block.get();
-				uint8_t *const bin_data = smd_data + SuperMagicDrive::SMD_BLOCK_SIZE;
 				size = d->file->seekAndRead(512, smd_data, SuperMagicDrive::SMD_BLOCK_SIZE);
 				if (size != SuperMagicDrive::SMD_BLOCK_SIZE) {
 					// Short read. ROM is invalid.
@@ -564,13 +582,16 @@ MegaDrive::MegaDrive(IRpFile *file)
 					break;
 				}
 
-				// Decode the SMD block.
-				SuperMagicDrive::decodeBlock(bin_data, smd_data);
+				// Decode the vector table and ROM header.
+				// Only the first 512 bytes of the block are
+				// used here, so skip deinterleaving the rest.
+				uint8_t bin_hdr[512];
+				SuperMagicDrive::decodeHeader(bin_hdr, smd_data);
 
 				// MD header is at 0x100.
 				// Vector table is at 0.
-				memcpy(&d->vectors,    bin_data,        sizeof(d->vectors));
-				memcpy(&d->romHeader, &bin_data[0x100], sizeof(d->romHeader));
+				memcpy(&d->vectors,    bin_hdr,        sizeof(d->vectors));
+				memcpy(&d->romHeader, &bin_hdr[0x100], sizeof(d->romHeader));
 				break;
 			}
 
@@ -605,6 +626,7 @@ MegaDrive::MegaDrive(IRpFile *file)
 		// Parse the MD region code.
 		d->md_region = MegaDriveRegions::parseRegionCodes(
 			d->romHeader.region_codes, sizeof(d->romHeader.region_codes));
+		d->md_bregion = MegaDriveRegions::getBrandingRegion(d->md_region);
 	} else {
 		// Not valid. Close the file.
 		d->file->unref();
@@ -672,13 +694,21 @@ int MegaDrive::isRomSupported_static(const DetectInfo *info)
 			       MegaDrivePrivate::ROM_FORMAT_DISC_2048;
 		}
 
+		// All cartridge magic strings begin with "SEGA", so check
+		// the first four bytes at both possible offsets with single
+		// 32-bit compares before doing any full string comparisons.
+		uint32_t sega32, hdr100, hdr101;
+		memcpy(&sega32, sega_magic, sizeof(sega32));
+		memcpy(&hdr100, &pHeader[0x100], sizeof(hdr100));
+		memcpy(&hdr101, &pHeader[0x101], sizeof(hdr101));
+		const bool sega_at_100 = (hdr100 == sega32);
+		const bool sega_at_101 = (hdr101 == sega32);
+
 		// Check for SMD format. (Mega Drive only)
 		if (info->header.size >= 0x300) {
 			// Check if "SEGA" is in the header in the correct place
 			// for a plain binary ROM.
-			if (memcmp(&pHeader[0x100], sega_magic, sizeof(sega_magic)) != 0 &&
-			    memcmp(&pHeader[0x101], sega_magic, sizeof(sega_magic)) != 0)
-			{
+			if (!sega_at_100 && !sega_at_101) {
 				// "SEGA" is not in the header. This might be SMD.
 				const SMD_Header *smdHeader = reinterpret_cast<const SMD_Header*>(pHeader);
 				if (smdHeader->id[0] == 0xAA && smdHeader->id[1] == 0xBB &&
@@ -695,12 +725,16 @@ int MegaDrive::isRomSupported_static(const DetectInfo *info)
 		}
 
 		// Check for other MD-based cartridge formats.
-		for (int i = 0; i < ARRAY_SIZE(cart_magic); i++) {
-			if (!memcmp(&pHeader[0x100], cart_magic[i].sys_name, cart_magic[i].sys_name_len_100h) ||
-			    !memcmp(&pHeader[0x101], cart_magic[i].sys_name, cart_magic[i].sys_name_len_101h))
-			{
-				// Found a matching system name.
-				return MegaDrivePrivate::ROM_FORMAT_CART_BIN | cart_magic[i].system_id;
+		// The "SEGA" prefix was already verified above, so the
+		// full comparisons only run for actual MD-family ROMs.
+		if (sega_at_100 || sega_at_101) {
+			for (int i = 0; i < ARRAY_SIZE(cart_magic); i++) {
+				if ((sega_at_100 && !memcmp(&pHeader[0x100], cart_magic[i].sys_name, cart_magic[i].sys_name_len_100h)) ||
+				    (sega_at_101 && !memcmp(&pHeader[0x101], cart_magic[i].sys_name, cart_magic[i].sys_name_len_101h)))
+				{
+					// Found a matching system name.
+					return MegaDrivePrivate::ROM_FORMAT_CART_BIN | cart_magic[i].system_id;
+				}
 			}
 		}
 	}
@@ -753,71 +787,74 @@ const char *MegaDrive::systemName(unsigned int type) const
 		return sysNames[romSys][idx];
 	}
 
-	// Get the system branding region.
-	const MegaDriveRegions::MD_BrandingRegion md_bregion =
-		MegaDriveRegions::getBrandingRegion(d->md_region);
-	switch (md_bregion) {
-		case MegaDriveRegions::MD_BREGION_JAPAN:
-		default: {
-			static const char *const sysNames_JP[5][4] = {
-				{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
-				{"Sega Mega CD", "Mega CD", "MCD", nullptr},
-				{"Sega Super 32X", "Super 32X", "32X", nullptr},
-				{"Sega Mega CD 32X", "Mega CD 32X", "MCD32X", nullptr},
-				{"Sega Kids Computer Pico", "Kids Computer Pico", "Pico", nullptr}
-			};
-			return sysNames_JP[romSys][idx];
-		}
+	// Region-specific system names.
+	// Indexed by MD_BrandingRegion; the MD_BREGION_UNKNOWN row
+	// uses the Japanese names, which matches the old switch default.
+	static const char *const sysNames_region[6][5][4] = {
+		// MD_BREGION_UNKNOWN
+		{
+			{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
+			{"Sega Mega CD", "Mega CD", "MCD", nullptr},
+			{"Sega Super 32X", "Super 32X", "32X", nullptr},
+			{"Sega Mega CD 32X", "Mega CD 32X", "MCD32X", nullptr},
+			{"Sega Kids Computer Pico", "Kids Computer Pico", "Pico", nullptr}
+		},
 
-		case MegaDriveRegions::MD_BREGION_USA: {
-			static const char *const sysNames_US[5][4] = {
-				// TODO: "MD" or "Gen"?
-				{"Sega Genesis", "Genesis", "MD", nullptr},
-				{"Sega CD", "Sega CD", "MCD", nullptr},
-				{"Sega 32X", "Sega 32X", "32X", nullptr},
-				{"Sega CD 32X", "Sega CD 32X", "MCD32X", nullptr},
-				{"Sega Pico", "Pico", "Pico", nullptr}
-			};
-			return sysNames_US[romSys][idx];
-		}
+		// MD_BREGION_JAPAN
+		{
+			{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
+			{"Sega Mega CD", "Mega CD", "MCD", nullptr},
+			{"Sega Super 32X", "Super 32X", "32X", nullptr},
+			{"Sega Mega CD 32X", "Mega CD 32X", "MCD32X", nullptr},
+			{"Sega Kids Computer Pico", "Kids Computer Pico", "Pico", nullptr}
+		},
 
-		case MegaDriveRegions::MD_BREGION_EUROPE: {
-			static const char *const sysNames_EU[5][4] = {
-				{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
-				{"Sega Mega CD", "Mega CD", "MCD", nullptr},
-				{"Sega Mega Drive 32X", "Mega Drive 32X", "32X", nullptr},
-				{"Sega Mega CD 32X", "Sega Mega CD 32X", "MCD32X", nullptr},
-				{"Sega Pico", "Pico", "Pico", nullptr}
-			};
-			return sysNames_EU[romSys][idx];
-		}
+		// MD_BREGION_USA
+		{
+			// TODO: "MD" or "Gen"?
+			{"Sega Genesis", "Genesis", "MD", nullptr},
+			{"Sega CD", "Sega CD", "MCD", nullptr},
+			{"Sega 32X", "Sega 32X", "32X", nullptr},
+			{"Sega CD 32X", "Sega CD 32X", "MCD32X", nullptr},
+			{"Sega Pico", "Pico", "Pico", nullptr}
+		},
 
-		case MegaDriveRegions::MD_BREGION_SOUTH_KOREA: {
-			static const char *const sysNames_KR[5][4] = {
-				// TODO: "MD" or something else?
-				{"Samsung Super Aladdin Boy", "Super Aladdin Boy", "MD", nullptr},
-				{"Samsung CD Aladdin Boy", "CD Aladdin Boy", "MCD", nullptr},
-				{"Samsung Super 32X", "Super 32X", "32X", nullptr},
-				{"Sega Mega CD 32X", "Sega Mega CD 32X", "MCD32X", nullptr},
-				{"Sega Pico", "Pico", "Pico", nullptr}
-			};
-			return sysNames_KR[romSys][idx];
-		}
+		// MD_BREGION_EUROPE
+		{
+			{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
+			{"Sega Mega CD", "Mega CD", "MCD", nullptr},
+			{"Sega Mega Drive 32X", "Mega Drive 32X", "32X", nullptr},
+			{"Sega Mega CD 32X", "Sega Mega CD 32X", "MCD32X", nullptr},
+			{"Sega Pico", "Pico", "Pico", nullptr}
+		},
 
-		case MegaDriveRegions::MD_BREGION_BRAZIL: {
-			static const char *const sysNames_BR[5][4] = {
-				{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
-				{"Sega CD", "Sega CD", "MCD", nullptr},
-				{"Sega Mega 32X", "Mega 32X", "32X", nullptr},
-				{"Sega CD 32X", "Sega CD 32X", "MCD32X", nullptr},
-				{"Sega Pico", "Pico", "Pico", nullptr}
-			};
-			return sysNames_BR[romSys][idx];
-		}
-	}
+		// MD_BREGION_SOUTH_KOREA
+		{
+			// TODO: "MD" or something else?
+			{"Samsung Super Aladdin Boy", "Super Aladdin Boy", "MD", nullptr},
+			{"Samsung CD Aladdin Boy", "CD Aladdin Boy", "MCD", nullptr},
+			{"Samsung Super 32X", "Super 32X", "32X", nullptr},
+			{"Sega Mega CD 32X", "Sega Mega CD 32X", "MCD32X", nullptr},
+			{"Sega Pico", "Pico", "Pico", nullptr}
+		},
 
-	// Should not get here...
-	return nullptr;
+		// MD_BREGION_BRAZIL
+		{
+			{"Sega Mega Drive", "Mega Drive", "MD", nullptr},
+			{"Sega CD", "Sega CD", "MCD", nullptr},
+			{"Sega Mega 32X", "Mega 32X", "32X", nullptr},
+			{"Sega CD 32X", "Sega CD 32X", "MCD32X", nullptr},
+			{"Sega Pico", "Pico", "Pico", nullptr}
+		},
+	};
+
+	// Use the branding region cached at construction.
+	unsigned int md_bregion = static_cast<unsigned int>(d->md_bregion);
+	if (md_bregion >= ARRAY_SIZE(sysNames_region)) {
+		// Invalid branding region. Default to Japan.
+		md_bregion = MegaDriveRegions::MD_BREGION_JAPAN;
+	}
+	return sysNames_region[md_bregion][romSys][idx];
 }
 
 /**
@@ -923,14 +960,13 @@ int MegaDrive::loadFieldData(void)
 		if ((d->romType & MegaDrivePrivate::ROM_FORMAT_MASK) == MegaDrivePrivate::ROM_FORMAT_CART_SMD) {
 			// Load the 16K block and deinterleave it.
 			if (d->file->size() >= (512 + (2*1024*1024) + 16384)) {
-				auto block = aligned_uptr<uint8_t>(16, SuperMagicDrive::SMD_BLOCK_SIZE * 2);
+				auto block = aligned_uptr<uint8_t>(16, SuperMagicDrive::SMD_BLOCK_SIZE);
 				uint8_t *const smd_data = block.get();
-				uint8_t *const bin_data = smd_data + SuperMagicDrive::SMD_BLOCK_SIZE;
 				size_t size = d->file->seekAndRead(512 + (2*1024*1024), smd_data, SuperMagicDrive::SMD_BLOCK_SIZE);
 				if (size == SuperMagicDrive::SMD_BLOCK_SIZE) {
-					// Deinterleave the block.
-					SuperMagicDrive::decodeBlock(bin_data, smd_data);
-					memcpy(header, bin_data, sizeof(header));
+					// Deinterleave the ROM header.
+					// Only the first 512 bytes are used here.
+					SuperMagicDrive::decodeHeader(header, smd_data);
 					header_loaded = true;
 				}
 			}
@@ -941,11 +977,14 @@ int MegaDrive::loadFieldData(void)
 		}
 
 		if (header_loaded) {
-			// Check the "SEGA" magic.
+			// Check the "SEGA" magic with single 32-bit compares,
+			// as in isRomSupported_static().
 			static const char sega_magic[4] = {'S','E','G','A'};
-			if (!memcmp(&header[0x100], sega_magic, sizeof(sega_magic)) ||
-			    !memcmp(&header[0x101], sega_magic, sizeof(sega_magic)))
-			{
+			uint32_t sega32, hdr100, hdr101;
+			memcpy(&sega32, sega_magic, sizeof(sega32));
+			memcpy(&hdr100, &header[0x100], sizeof(hdr100));
+			memcpy(&hdr101, &header[0x101], sizeof(hdr101));
+			if (hdr100 == sega32 || hdr101 == sega32) {
 				// Found the "SEGA" magic.
 				// Reserve more fields for the second ROM header.
 				d->fields->reserve(27);
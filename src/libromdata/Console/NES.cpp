@@ -26,14 +26,13 @@ using namespace LibRpBase;
  // C includes. (C++ namespace)
 #include <cassert>
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 #include <ctime>
 
  // C++ includes.
 #include <string>
-#include <vector>
 using std::string;
-using std::vector;
 
 namespace LibRomData {
 
@@ -122,8 +121,9 @@ NESPrivate::NESPrivate(NES *q, IRpFile *file)
 	: super(q, file)
 	, romType(ROM_UNKNOWN)
 {
-	// Clear the ROM header structs.
-	memset(&header, 0, sizeof(header));
+	// NOTE: The ROM header structs are only read after the
+	// constructor has copied in the detected header(s), so
+	// there's no need to clear them here.
 }
 
 /**
@@ -137,7 +137,11 @@ NESPrivate::NESPrivate(NES *q, IRpFile *file)
  */
 inline string NESPrivate::formatBankSizeKiB(unsigned int size)
 {
-	return rp_sprintf("%u KiB", (size / 1024));
+	// NOTE: Fixed format with a bounded length, so snprintf()
+	// directly into a stack buffer instead of using rp_sprintf().
+	char buf[16];
+	int len = snprintf(buf, sizeof(buf), "%u KiB", (size / 1024));
+	return string(buf, len);
 }
 
 /**
@@ -155,13 +159,12 @@ time_t NESPrivate::fds_bcd_datestamp_to_unix_time(const FDS_BCD_DateStamp *fds_b
 	// NOTE: struct tm has some oddities:
 	// - tm_year: year - 1900
 	// - tm_mon: 0 == January
-	if ((fds_bcd_ds->year == 0 &&
-	     fds_bcd_ds->mon == 0 &&
-	     fds_bcd_ds->mday == 0) ||
-	    (fds_bcd_ds->year == 0xFF &&
-	     fds_bcd_ds->mon == 0xFF &&
-	     fds_bcd_ds->mday == 0xFF))
-	{
+	// Invalid datestamps are either all zero or all 0xFF,
+	// so pack the three bytes and do two compares.
+	const uint32_t ymd = static_cast<uint32_t>(fds_bcd_ds->year) |
+			     (static_cast<uint32_t>(fds_bcd_ds->mon) << 8) |
+			     (static_cast<uint32_t>(fds_bcd_ds->mday) << 16);
+	if (ymd == 0 || ymd == 0x00FFFFFF) {
 		// Invalid date.
 		return -1;
 	}
@@ -169,12 +172,12 @@ time_t NESPrivate::fds_bcd_datestamp_to_unix_time(const FDS_BCD_DateStamp *fds_b
 	struct tm fdstime;
 
 	// TODO: Check for invalid BCD values.
-	fdstime.tm_year = ((fds_bcd_ds->year >> 4) * 10) +
-			   (fds_bcd_ds->year & 0x0F) + 1925 - 1900;
-	fdstime.tm_mon  = ((fds_bcd_ds->mon >> 4) * 10) +
-			   (fds_bcd_ds->mon & 0x0F) - 1;
-	fdstime.tm_mday = ((fds_bcd_ds->mday >> 4) * 10) +
-			   (fds_bcd_ds->mday & 0x0F);
+	// NOTE: For a BCD byte x == (16*tens + units), the decoded
+	// value (10*tens + units) is simply (x - 6*(x >> 4)).
+	fdstime.tm_year = fds_bcd_ds->year - ((fds_bcd_ds->year >> 4) * 6)
+			  + 1925 - 1900;
+	fdstime.tm_mon  = fds_bcd_ds->mon  - ((fds_bcd_ds->mon  >> 4) * 6) - 1;
+	fdstime.tm_mday = fds_bcd_ds->mday - ((fds_bcd_ds->mday >> 4) * 6);
 
 	// Time portion is empty.
 	fdstime.tm_hour = 0;
@@ -216,12 +219,9 @@ NES::NES(IRpFile *file)
 		return;
 	}
 	
-	// Seek to the beginning of the header.
-	d->file->rewind();
-
 	// Read the ROM header. [128 bytes]
 	uint8_t header[128];
-	size_t size = d->file->read(header, sizeof(header));
+	size_t size = d->file->seekAndRead(0, header, sizeof(header));
 	if (size != sizeof(header)) {
 		d->file->unref();
 		d->file = nullptr;
@@ -317,14 +317,13 @@ int NES::isRomSupported_static(const DetectInfo *info)
 	// Check for iNES.
 	const INES_RomHeader *inesHeader =
 		reinterpret_cast<const INES_RomHeader*>(info->header.pData);
-	if (inesHeader->magic == cpu_to_be32(INES_MAGIC) ||
-	    inesHeader->magic == cpu_to_be32(INES_MAGIC_WIIU_VC))
-	{
+	// NOTE: The Wii U VC magic is the iNES magic with the last
+	// byte cleared, so compare it once and reuse the result.
+	const bool is_wiiu_vc = (inesHeader->magic == cpu_to_be32(INES_MAGIC_WIIU_VC));
+	if (inesHeader->magic == cpu_to_be32(INES_MAGIC) || is_wiiu_vc) {
 		// Found an iNES ROM header.
 		// If the fourth byte is 0x00, it's Wii U VC.
-		int romType = (inesHeader->magic == cpu_to_be32(INES_MAGIC_WIIU_VC))
-				? NESPrivate::ROM_SPECIAL_WIIU_VC
-				: 0;
+		int romType = (is_wiiu_vc ? NESPrivate::ROM_SPECIAL_WIIU_VC : 0);
 
 		// Check for NES 2.0.
 		if ((inesHeader->mapper_hi & 0x0C) == 0x08) {
@@ -358,12 +357,10 @@ int NES::isRomSupported_static(const DetectInfo *info)
 		// Not NES 2.0.
 		if ((inesHeader->mapper_hi & 0x0C) == 0x00) {
 			// May be iNES.
-			// TODO: Optimize this check?
-			if (info->header.pData[12] == 0 &&
-			    info->header.pData[13] == 0 &&
-			    info->header.pData[14] == 0 &&
-			    info->header.pData[15] == 0)
-			{
+			// Check bytes 12-15 with a single 32-bit compare.
+			uint32_t tail;
+			memcpy(&tail, &info->header.pData[12], sizeof(tail));
+			if (tail == 0) {
 				// Definitely iNES.
 				switch (inesHeader->mapper_hi & INES_F7_SYSTEM_MASK) {
 					case INES_F7_SYSTEM_VS:
@@ -459,73 +456,80 @@ const char *NES::systemName(unsigned int type) const
 	static_assert(SYSNAME_TYPE_MASK == 3,
 		"NES::systemName() array index optimization needs to be updated.");
 
-	const unsigned int idx = (type & SYSNAME_TYPE_MASK);
-	switch (d->romType & NESPrivate::ROM_SYSTEM_MASK) {
-		case NESPrivate::ROM_SYSTEM_NES:
-		default: {
-			static const char *const sysNames_NES[3][4] = {
-				// NES (International)
-				{"Nintendo Entertainment System",
-				 "Nintendo Entertainment System",
-				 "NES", nullptr},
-
-				// Famicom (Japan)
-				{"Nintendo Famicom",
-				 "Famicom",
-				 "FC", nullptr},
-
-				// Hyundai Comboy (South Korea)
-				{"Hyundai Comboy",
-				 "Comboy",
-				 "CB", nullptr},
-			};
-
-			if ((type & SYSNAME_REGION_MASK) == SYSNAME_REGION_GENERIC) {
-				// Use the international name.
-				return sysNames_NES[0][idx];
-			}
-
-			// Get the system region.
-			switch (SystemRegion::getCountryCode()) {
-				case 'JP':
-					return sysNames_NES[1][idx];
-				case 'KR':
-					return sysNames_NES[2][idx];
-				default:
-					return sysNames_NES[0][idx];
-			}
-		}
-
-		case NESPrivate::ROM_SYSTEM_FDS: {
-			static const char *const sysNames_FDS[] = {
-				"Nintendo Famicom Disk System",
-				"Famicom Disk System",
-				"FDS", nullptr
-			};
-			return sysNames_FDS[idx];
-		}
+	// System names, indexed by [system][region][idx].
+	// Region index: 0 == international, 1 == Japan, 2 == South Korea.
+	// Only the NES has regional variants; the other systems
+	// duplicate the same row for all three regions.
+	static const char *const sysNames[4][3][4] = {
+		{	// NES / Famicom / Comboy
+			{"Nintendo Entertainment System",
+			 "Nintendo Entertainment System",
+			 "NES", nullptr},
+			{"Nintendo Famicom",
+			 "Famicom",
+			 "FC", nullptr},
+			{"Hyundai Comboy",
+			 "Comboy",
+			 "CB", nullptr},
+		},
+		{	// Famicom Disk System
+			{"Nintendo Famicom Disk System",
+			 "Famicom Disk System",
+			 "FDS", nullptr},
+			{"Nintendo Famicom Disk System",
+			 "Famicom Disk System",
+			 "FDS", nullptr},
+			{"Nintendo Famicom Disk System",
+			 "Famicom Disk System",
+			 "FDS", nullptr},
+		},
+		{	// VS. System
+			{"Nintendo VS. System",
+			 "VS. System",
+			 "VS", nullptr},
+			{"Nintendo VS. System",
+			 "VS. System",
+			 "VS", nullptr},
+			{"Nintendo VS. System",
+			 "VS. System",
+			 "VS", nullptr},
+		},
+		{	// PlayChoice-10
+			{"Nintendo PlayChoice-10",
+			 "PlayChoice-10",
+			 "PC10", nullptr},
+			{"Nintendo PlayChoice-10",
+			 "PlayChoice-10",
+			 "PC10", nullptr},
+			{"Nintendo PlayChoice-10",
+			 "PlayChoice-10",
+			 "PC10", nullptr},
+		},
+	};
 
-		case NESPrivate::ROM_SYSTEM_VS: {
-			static const char *const sysNames_VS[] = {
-				"Nintendo VS. System",
-				"VS. System",
-				"VS", nullptr
-			};
-			return sysNames_VS[idx];
-		}
+	const unsigned int idx = (type & SYSNAME_TYPE_MASK);
+	unsigned int sys = (d->romType & NESPrivate::ROM_SYSTEM_MASK) >> 8;
+	if (sys >= ARRAY_SIZE(sysNames)) {
+		// ROM_SYSTEM_UNKNOWN. Use the NES names.
+		sys = 0;
+	}
 
-		case NESPrivate::ROM_SYSTEM_PC10: {
-			static const char *const sysNames_PC10[] = {
-				"Nintendo PlayChoice-10",
-				"PlayChoice-10",
-				"PC10", nullptr
-			};
-			return sysNames_PC10[idx];
+	unsigned int region = 0;
+	if ((type & SYSNAME_REGION_MASK) != SYSNAME_REGION_GENERIC) {
+		// Get the system region.
+		switch (SystemRegion::getCountryCode()) {
+			case 'JP':
+				region = 1;
+				break;
+			case 'KR':
+				region = 2;
+				break;
+			default:
+				break;
 		}
-	};
+	}
 
-	// Should not get here...
-	return nullptr;
+	return sysNames[sys][region][idx];
 }
 
 /**
@@ -596,10 +600,10 @@ int NES::loadFieldData(void)
 	if (!d->fields->empty()) {
 		// Field data *has* been loaded...
 		return 0;
-	} else if (!d->file || !d->file->isOpen()) {
+	} else if (unlikely(!d->file || !d->file->isOpen())) {
 		// File isn't open.
 		return -EBADF;
-	} else if (!d->isValid) {
+	} else if (unlikely(!d->isValid)) {
 		// ROM image isn't valid.
 		return -EIO;
 	}
@@ -613,6 +617,11 @@ int NES::loadFieldData(void)
 	// iNES, Internal Footer
 	d->fields->reserveTabs(2);
 
+	// Copy the iNES header to the stack. The compiler otherwise
+	// has to assume the RomFields calls below can modify it and
+	// reloads the fields on every access.
+	const INES_RomHeader ines = d->header.ines;
+
 	// Determine stuff based on the ROM format.
 	const char *rom_format;
 	bool romOK = true;
@@ -632,14 +641,14 @@ int NES::loadFieldData(void)
 		case NESPrivate::ROM_FORMAT_OLD_INES:
 			d->fields->setTabName(0, "iNES");
 			rom_format = C_("NES|Format", "Archaic iNES");
-			mapper = (d->header.ines.mapper_lo >> 4);
-			has_trainer = !!(d->header.ines.mapper_lo & INES_F6_TRAINER);
-			prg_rom_size = d->header.ines.prg_banks * INES_PRG_BANK_SIZE;
-			chr_rom_size = d->header.ines.chr_banks * INES_CHR_BANK_SIZE;
+			mapper = (ines.mapper_lo >> 4);
+			has_trainer = !!(ines.mapper_lo & INES_F6_TRAINER);
+			prg_rom_size = ines.prg_banks * INES_PRG_BANK_SIZE;
+			chr_rom_size = ines.chr_banks * INES_CHR_BANK_SIZE;
 			if (chr_rom_size == 0) {
 				chr_ram_size = 8192;
 			}
-			if (d->header.ines.mapper_lo & INES_F6_BATTERY) {
+			if (ines.mapper_lo & INES_F6_BATTERY) {
 				prg_ram_battery_size = 8192;
 			}
 			break;
@@ -647,27 +656,27 @@ int NES::loadFieldData(void)
 		case NESPrivate::ROM_FORMAT_INES:
 			d->fields->setTabName(0, "iNES");
 			rom_format = "iNES";	// NOT translatable!
-			mapper = (d->header.ines.mapper_lo >> 4) |
-				 (d->header.ines.mapper_hi & 0xF0);
-			has_trainer = !!(d->header.ines.mapper_lo & INES_F6_TRAINER);
+			mapper = (ines.mapper_lo >> 4) |
+				 (ines.mapper_hi & 0xF0);
+			has_trainer = !!(ines.mapper_lo & INES_F6_TRAINER);
 			// NOTE: Very few iNES ROMs have this set correctly,
 			// so we're ignoring it for now.
-			//tv_mode = (d->header.ines.ines.tv_mode & 1);
-			prg_rom_size = d->header.ines.prg_banks * INES_PRG_BANK_SIZE;
-			chr_rom_size = d->header.ines.chr_banks * INES_CHR_BANK_SIZE;
+			//tv_mode = (ines.ines.tv_mode & 1);
+			prg_rom_size = ines.prg_banks * INES_PRG_BANK_SIZE;
+			chr_rom_size = ines.chr_banks * INES_CHR_BANK_SIZE;
 			if (chr_rom_size == 0) {
 				chr_ram_size = 8192;
 			}
-			if (d->header.ines.mapper_lo & INES_F6_BATTERY) {
-				if (d->header.ines.ines.prg_ram_size == 0) {
+			if (ines.mapper_lo & INES_F6_BATTERY) {
+				if (ines.ines.prg_ram_size == 0) {
 					prg_ram_battery_size = 8192;
 				} else {
-					prg_ram_battery_size = d->header.ines.ines.prg_ram_size * INES_PRG_RAM_BANK_SIZE;
+					prg_ram_battery_size = ines.ines.prg_ram_size * INES_PRG_RAM_BANK_SIZE;
 				}
 			} else {
 				// FIXME: Is this correct?
-				if (d->header.ines.ines.prg_ram_size > 0) {
-					prg_ram_size = d->header.ines.ines.prg_ram_size * INES_PRG_RAM_BANK_SIZE;
+				if (ines.ines.prg_ram_size > 0) {
+					prg_ram_size = ines.ines.prg_ram_size * INES_PRG_RAM_BANK_SIZE;
 				}
 			}
 			break;
@@ -675,32 +684,32 @@ int NES::loadFieldData(void)
 		case NESPrivate::ROM_FORMAT_NES2:
 			d->fields->setTabName(0, "NES 2.0");
 			rom_format = "NES 2.0";	// NOT translatable!
-			mapper = (d->header.ines.mapper_lo >> 4) |
-				 (d->header.ines.mapper_hi & 0xF0) |
-				 ((d->header.ines.nes2.mapper_hi2 & 0x0F) << 8);
-			submapper = (d->header.ines.nes2.mapper_hi2 >> 4);
-			has_trainer = !!(d->header.ines.mapper_lo & INES_F6_TRAINER);
-			tv_mode = (d->header.ines.nes2.tv_mode & 3);
-			prg_rom_size = ((d->header.ines.prg_banks +
-					(d->header.ines.nes2.prg_banks_hi << 8))
+			mapper = (ines.mapper_lo >> 4) |
+				 (ines.mapper_hi & 0xF0) |
+				 ((ines.nes2.mapper_hi2 & 0x0F) << 8);
+			submapper = (ines.nes2.mapper_hi2 >> 4);
+			has_trainer = !!(ines.mapper_lo & INES_F6_TRAINER);
+			tv_mode = (ines.nes2.tv_mode & 3);
+			prg_rom_size = ((ines.prg_banks +
+					(ines.nes2.prg_banks_hi << 8))
 					* INES_PRG_BANK_SIZE);
-			chr_rom_size = d->header.ines.chr_banks * INES_CHR_BANK_SIZE;
+			chr_rom_size = ines.chr_banks * INES_CHR_BANK_SIZE;
 			// CHR RAM size. (TODO: Needs testing.)
-			if (d->header.ines.nes2.vram_size & 0x0F) {
-				chr_ram_size = 128 << ((d->header.ines.nes2.vram_size & 0x0F) - 1);
+			if (ines.nes2.vram_size & 0x0F) {
+				chr_ram_size = 128 << ((ines.nes2.vram_size & 0x0F) - 1);
 			}
-			if ((d->header.ines.mapper_lo & INES_F6_BATTERY) &&
-			    (d->header.ines.nes2.vram_size & 0xF0))
+			if ((ines.mapper_lo & INES_F6_BATTERY) &&
+			    (ines.nes2.vram_size & 0xF0))
 			{
-				chr_ram_battery_size = 128 << ((d->header.ines.nes2.vram_size >> 4) - 1);
+				chr_ram_battery_size = 128 << ((ines.nes2.vram_size >> 4) - 1);
 			}
 			// PRG RAM size. (TODO: Needs testing.)
-			if (d->header.ines.nes2.prg_ram_size & 0x0F) {
-				prg_ram_size = 128 << ((d->header.ines.nes2.prg_ram_size >> 4) - 1);
+			if (ines.nes2.prg_ram_size & 0x0F) {
+				prg_ram_size = 128 << ((ines.nes2.prg_ram_size >> 4) - 1);
 			}
 			// TODO: Require INES_F6_BATTERY?
-			if (d->header.ines.nes2.prg_ram_size & 0xF0) {
-				prg_ram_battery_size = 128 << ((d->header.ines.nes2.prg_ram_size >> 4) - 1);
+			if (ines.nes2.prg_ram_size & 0xF0) {
+				prg_ram_battery_size = 128 << ((ines.nes2.prg_ram_size >> 4) - 1);
 			}
 			break;
 
@@ -826,16 +835,18 @@ int NES::loadFieldData(void)
 	}
 
 	// ROM features
-	const char *rom_features = nullptr;
-	if (prg_ram_battery_size > 0 && has_trainer) {
-		rom_features = C_("NES|Features", "Save RAM, Trainer");
-	} else if (prg_ram_battery_size > 0 && !has_trainer) {
-		rom_features = C_("NES|Features", "Save RAM");
-	} else if (prg_ram_battery_size == 0 && has_trainer) {
-		rom_features = C_("NES|Features", "Trainer");
-	}
-	if (rom_features) {
-		d->fields->addField_string(C_("NES", "Features"), rom_features);
+	static const char *const rom_features_tbl[] = {
+		nullptr,
+		NOP_C_("NES|Features", "Trainer"),
+		NOP_C_("NES|Features", "Save RAM"),
+		NOP_C_("NES|Features", "Save RAM, Trainer"),
+	};
+	const unsigned int rom_features_idx =
+		(static_cast<unsigned int>(prg_ram_battery_size > 0) << 1) |
+		 static_cast<unsigned int>(has_trainer);
+	if (rom_features_tbl[rom_features_idx]) {
+		d->fields->addField_string(C_("NES", "Features"),
+			dpgettext_expr(RP_I18N_DOMAIN, "NES|Features", rom_features_tbl[rom_features_idx]));
 	}
 
 	// ROM sizes
@@ -911,12 +922,12 @@ int NES::loadFieldData(void)
 				// Mirroring
 				// TODO: Detect mappers that have programmable mirroring.
 				// TODO: Also One Screen, e.g. AxROM.
-				if (d->header.ines.mapper_lo & INES_F6_MIRROR_FOUR) {
+				if (ines.mapper_lo & INES_F6_MIRROR_FOUR) {
 					// Four screens using extra VRAM.
 					s_mirroring = C_("NES|Mirroring", "Four Screens");
 				} else {
 					// TODO: There should be a "one screen" option...
-					if (d->header.ines.mapper_lo & INES_F6_MIRROR_VERT) {
+					if (ines.mapper_lo & INES_F6_MIRROR_VERT) {
 						s_mirroring = C_("NES|Mirroring", "Vertical");
 					} else {
 						s_mirroring = C_("NES|Mirroring", "Horizontal");
@@ -937,7 +948,7 @@ int NES::loadFieldData(void)
 						"RP2C05-03",   "RP2C05-04",
 						"RP2C05-05"
 					};
-					const unsigned int vs_ppu = (d->header.ines.nes2.vs_hw & 0x0F);
+					const unsigned int vs_ppu = (ines.nes2.vs_hw & 0x0F);
 					if (vs_ppu < ARRAY_SIZE(vs_ppu_types)) {
 						s_vs_ppu = vs_ppu_types[vs_ppu];
 					}
@@ -1008,30 +1019,20 @@ int NES::loadFieldData(void)
 			}
 
 			// Check if the name looks right.
-			firstNonFF = (unsigned int)sizeof(intFooter.name);
-			bool foundNonFF = false;
-			bool foundInvalid = false;
-			for (unsigned int i = 0; i < (unsigned int)sizeof(intFooter.name); i++) {
-				char chr = intFooter.name[i];
-
-				// Skip leading 0xFF.
-				if (chr == (char)0xFF) {
-					if (foundNonFF) {
-						// Cannot have 0xFF here.
-						foundInvalid = true;
-						break;
-					}
-					continue;
-				}
-				// Also skip leading spaces.
-				if (!foundNonFF && chr == ' ') {
-					continue;
-				}
+			// Skip the leading 0xFF and space filler, then verify
+			// that the rest of the name is printable ASCII.
+			// NOTE: 0xFF after the filler fails the >= 127 check.
+			unsigned int i = 0;
+			for (; i < (unsigned int)sizeof(intFooter.name); i++) {
+				const uint8_t chr = (uint8_t)intFooter.name[i];
+				if (chr != 0xFF && chr != ' ')
+					break;
+			}
+			firstNonFF = i;
 
-				if (!foundNonFF) {
-					foundNonFF = true;
-					firstNonFF = i;
-				}
+			bool foundInvalid = false;
+			for (; i < (unsigned int)sizeof(intFooter.name); i++) {
+				const uint8_t chr = (uint8_t)intFooter.name[i];
 				if (chr < 32 || chr >= 127) {
 					// Invalid character.
 					foundInvalid = true;
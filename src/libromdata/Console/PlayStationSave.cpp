@@ -217,7 +217,9 @@ PlayStationSave::PlayStationSave(IRpFile *file)
 	}
 
 	// Read the save file header.
-	uint8_t header[1024];
+	// The largest header layout is a PSV header followed by
+	// the SC struct, so that's all we need to read.
+	uint8_t header[sizeof(PS1_PSV_Header) + sizeof(PS1_SC_Struct)];
 	d->file->rewind();
 	size_t size = d->file->read(&header, sizeof(header));
 	if (size != sizeof(header)) {
@@ -289,11 +291,11 @@ int PlayStationSave::isRomSupported_static(const DetectInfo *info)
 		const PS1_SC_Struct *const scHeader =
 			reinterpret_cast<const PS1_SC_Struct*>(
 				&info->header.pData[sizeof(PS1_PSV_Header)]);
-		if (scHeader->magic == cpu_to_be16(PS1_SC_MAGIC)) {
+		if (unlikely(scHeader->magic == cpu_to_be16(PS1_SC_MAGIC))) {
 			// Check the PSV magic.
 			const PS1_PSV_Header *const psvHeader =
 				reinterpret_cast<const PS1_PSV_Header*>(info->header.pData);
-			if (psvHeader->magic == cpu_to_be64(PS1_PSV_MAGIC)) {
+			if (likely(psvHeader->magic == cpu_to_be64(PS1_PSV_MAGIC))) {
 				// This is a PSV (PS1 on PS3) save file.
 				return PlayStationSavePrivate::SAVE_TYPE_PSV;
 			}
@@ -309,49 +311,61 @@ int PlayStationSave::isRomSupported_static(const DetectInfo *info)
 		const PS1_SC_Struct *const scHeader =
 			reinterpret_cast<const PS1_SC_Struct*>(
 				&info->header.pData[sizeof(PS1_Block_Entry)]);
-		if (scHeader->magic == cpu_to_be16(PS1_SC_MAGIC)) {
+		if (unlikely(scHeader->magic == cpu_to_be16(PS1_SC_MAGIC))) {
 			const uint8_t *const header = info->header.pData;
 
-			// Check the block magic.
-			static const uint8_t block_magic[4] = {
-				PS1_ENTRY_ALLOC_FIRST, 0x00, 0x00, 0x00,
-			};
-			if (memcmp(header, block_magic, sizeof(block_magic)) != 0) {
+			// Check the block magic with a single 32-bit compare.
+			uint32_t block_magic;
+			memcpy(&block_magic, header, sizeof(block_magic));
+			if (block_magic != cpu_to_le32(PS1_ENTRY_ALLOC_FIRST)) {
 				// Block magic is incorrect.
 				return -1;
 			}
 
-			// Check the checksum
-			uint8_t checksum = 0;
-			for (int i = sizeof(PS1_Block_Entry)-1; i >= 0; i--) {
-				checksum ^= header[i];
+			// Check the checksum.
+			// XOR is associative, so fold 64 bits at a time,
+			// then reduce the accumulator down to one byte.
+			uint64_t acc = 0;
+			for (unsigned int i = 0; i < sizeof(PS1_Block_Entry); i += 8) {
+				uint64_t v;
+				memcpy(&v, &header[i], sizeof(v));
+				acc ^= v;
 			}
-			if (checksum != 0) return -1;
+			acc ^= (acc >> 32);
+			acc ^= (acc >> 16);
+			acc ^= (acc >> 8);
+			if ((acc & 0xFF) != 0) return -1;
 
 			return PlayStationSavePrivate::SAVE_TYPE_BLOCK;
 		}
 	}
 
+	// The 54-byte and RAW formats require a specific file size
+	// modulo, so check that first: it's a register operation on
+	// data we already have, while the magic compare may touch a
+	// cold cache line for a non-candidate file.
+	const unsigned int szMod8192 = static_cast<unsigned int>(info->szFile % 8192);
+
 	// Check for PS1 54.
-	if (info->header.size >= sizeof(PS1_54_Header) + sizeof(PS1_SC_Struct)) {
+	if (szMod8192 == 54 &&
+	    info->header.size >= sizeof(PS1_54_Header) + sizeof(PS1_SC_Struct))
+	{
 		// Check for SC magic.
 		const PS1_SC_Struct *const scHeader =
 			reinterpret_cast<const PS1_SC_Struct*>(
 				&info->header.pData[sizeof(PS1_54_Header)]);
-		if (scHeader->magic == cpu_to_be16(PS1_SC_MAGIC)) {
-			// Extra filesize check to prevent false-positives
-			if (info->szFile % 8192 != 54) return -1;
+		if (unlikely(scHeader->magic == cpu_to_be16(PS1_SC_MAGIC))) {
 			return PlayStationSavePrivate::SAVE_TYPE_54;
 		}
 	}
 
 	// Check for PS1 SC by itself.
-	const PS1_SC_Struct *const scHeader =
-		reinterpret_cast<const PS1_SC_Struct*>(info->header.pData);
-	if (scHeader->magic == cpu_to_be16(PS1_SC_MAGIC)) {
-		// Extra filesize check to prevent false-positives
-		if (info->szFile % 8192 != 0) return -1;
-		return PlayStationSavePrivate::SAVE_TYPE_RAW;
+	if (szMod8192 == 0) {
+		const PS1_SC_Struct *const scHeader =
+			reinterpret_cast<const PS1_SC_Struct*>(info->header.pData);
+		if (unlikely(scHeader->magic == cpu_to_be16(PS1_SC_MAGIC))) {
+			return PlayStationSavePrivate::SAVE_TYPE_RAW;
+		}
 	}
 
 	// Not supported.
@@ -73,6 +73,9 @@ class WiiUPrivate : public RomDataPrivate
 
 		// Disc header.
 		WiiU_DiscHeader discHeader;
+
+		// Publisher ID. (Looked up in the constructor.)
+		uint32_t publisher_id;
 };
 
 /** WiiUPrivate **/
@@ -81,9 +84,10 @@ WiiUPrivate::WiiUPrivate(WiiU *q, IRpFile *file)
 	: super(q, file)
 	, discType(DISC_UNKNOWN)
 	, discReader(nullptr)
+	, publisher_id(0)
 {
-	// Clear the discHeader struct.
-	memset(&discHeader, 0, sizeof(discHeader));
+	// NOTE: The discHeader struct is only read after it's been
+	// copied from the disc image, so there's no need to clear it here.
 }
 
 WiiUPrivate::~WiiUPrivate()
@@ -125,9 +129,8 @@ WiiU::WiiU(IRpFile *file)
 	static_assert(sizeof(GCN_DiscHeader) >= sizeof(WiiU_DiscHeader),
 		"GCN_DiscHeader is smaller than WiiU_DiscHeader.");
 	uint8_t header[sizeof(GCN_DiscHeader)];
-	d->file->rewind();
-	size_t size = d->file->read(header, sizeof(header));
-	if (size != sizeof(header)) {
+	size_t size = d->file->seekAndRead(0, header, sizeof(header));
+	if (unlikely(size != sizeof(header))) {
 		d->file->unref();
 		d->file = nullptr;
 		return;
@@ -141,7 +144,7 @@ WiiU::WiiU(IRpFile *file)
 	info.ext = nullptr;	// Not needed for Wii U.
 	info.szFile = d->file->size();
 	d->discType = isRomSupported_static(&info);
-	if (d->discType < 0) {
+	if (unlikely(d->discType < 0)) {
 		// Disc image is invalid.
 		d->file->unref();
 		d->file = nullptr;
@@ -158,9 +161,14 @@ WiiU::WiiU(IRpFile *file)
 			break;
 		case WiiUPrivate::DISC_UNKNOWN:
 		default:
+			// Unsupported disc format.
+			// NOTE: This shouldn't happen, since isRomSupported_static()
+			// rejected the image already.
 			d->fileType = FTYPE_UNKNOWN;
 			d->discType = WiiUPrivate::DISC_UNKNOWN;
-			break;
+			d->file->unref();
+			d->file = nullptr;
+			return;
 	}
 
 	if (!d->discReader->isOpen()) {
@@ -172,48 +180,32 @@ WiiU::WiiU(IRpFile *file)
 		return;
 	}
 
-	if (d->discType < 0) {
-		// Nothing else to do here.
-		d->file->unref();
-		d->file = nullptr;
-		return;
-	}
-
 	// Re-read the disc header for WUX.
+	bool readOK = true;
 	if (d->discType > WiiUPrivate::DISC_FORMAT_WUD) {
 		size = d->discReader->seekAndRead(0, header, sizeof(header));
-		if (size != sizeof(header)) {
-			// Seek and/or read error.
-			delete d->discReader;
-			d->file->unref();
-			d->discReader = nullptr;
-			d->file = nullptr;
-			d->discType = WiiUPrivate::DISC_UNKNOWN;
-			return;
-		}
+		readOK = (size == sizeof(header));
 	}
 
 	// Verify the secondary magic number at 0x10000.
-	uint32_t disc_magic;
-	size = d->discReader->seekAndRead(0x10000, &disc_magic, sizeof(disc_magic));
-	if (size != sizeof(disc_magic)) {
-		// Seek and/or read error.
-		delete d->discReader;
-		d->file->unref();
-		d->discReader = nullptr;
-		d->file = nullptr;
-		d->discType = WiiUPrivate::DISC_UNKNOWN;
-		return;
+	uint32_t disc_magic = 0;
+	if (readOK) {
+		size = d->discReader->seekAndRead(0x10000, &disc_magic, sizeof(disc_magic));
+		readOK = (size == sizeof(disc_magic));
 	}
 
-	if (disc_magic == cpu_to_be32(WIIU_SECONDARY_MAGIC)) {
+	if (likely(readOK && disc_magic == cpu_to_be32(WIIU_SECONDARY_MAGIC))) {
 		// Secondary magic matches.
 		d->isValid = true;
 
 		// Save the disc header.
 		memcpy(&d->discHeader, header, sizeof(d->discHeader));
+
+		// Look up the publisher ID.
+		// Both loadFieldData() and extURLs() need it.
+		d->publisher_id = WiiUData::lookup_disc_publisher(d->discHeader.id4);
 	} else {
-		// No match.
+		// Seek and/or read error, or the secondary magic doesn't match.
 		delete d->discReader;
 		d->file->unref();
 		d->discReader = nullptr;
@@ -248,10 +240,12 @@ int WiiU::isRomSupported_static(const DetectInfo *info)
 	}
 
 	// Check for WUX magic numbers.
+	// NOTE: The two 32-bit magic numbers are contiguous,
+	// so they can be checked with a single 64-bit compare.
 	const wuxHeader_t *const wuxHeader = reinterpret_cast<const wuxHeader_t*>(info->header.pData);
-	if (wuxHeader->magic[0] == cpu_to_le32(WUX_MAGIC_0) &&
-	    wuxHeader->magic[1] == cpu_to_le32(WUX_MAGIC_1))
-	{
+	uint64_t wux_magic;
+	memcpy(&wux_magic, wuxHeader->magic, sizeof(wux_magic));
+	if (unlikely(wux_magic == cpu_to_le64((static_cast<uint64_t>(WUX_MAGIC_1) << 32) | WUX_MAGIC_0))) {
 		// WUX header detected.
 		// TODO: Also check for other Wii U magic numbers if WUX is found.
 		// TODO: Verify block size?
@@ -262,18 +256,29 @@ int WiiU::isRomSupported_static(const DetectInfo *info)
 	// NOTE: There's also a secondary magic number at 0x10000,
 	// but we can't check it here.
 	const WiiU_DiscHeader *const wiiu_header = reinterpret_cast<const WiiU_DiscHeader*>(info->header.pData);
-	if (memcmp(wiiu_header->id, "WUP-", 4) != 0) {
+	uint32_t wup;
+	memcpy(&wup, wiiu_header->id, sizeof(wup));
+	if (likely(wup != cpu_to_be32('WUP-'))) {
 		// Not Wii U.
 		return -1;
 	}
 
 	// Check hyphens.
+	// NOTE: The five hyphens are scattered across the first 21 bytes
+	// of the header, so two masked 64-bit compares cover all of them
+	// without a separate branch per byte.
 	// TODO: Verify version numbers and region code.
-	if (wiiu_header->hyphen1 != '-' ||
-	    wiiu_header->hyphen2 != '-' ||
-	    wiiu_header->hyphen3 != '-' ||
-	    wiiu_header->hyphen4 != '-' ||
-	    wiiu_header->hyphen5 != '-')
+	static_assert(offsetof(WiiU_DiscHeader, hyphen2) - offsetof(WiiU_DiscHeader, hyphen1) == 2,
+		"WiiU_DiscHeader.hyphen2 mask byte is incorrect.");
+	static_assert(offsetof(WiiU_DiscHeader, hyphen3) - offsetof(WiiU_DiscHeader, hyphen1) == 7,
+		"WiiU_DiscHeader.hyphen3 mask byte is incorrect.");
+	static_assert(offsetof(WiiU_DiscHeader, hyphen5) - offsetof(WiiU_DiscHeader, hyphen4) == 7,
+		"WiiU_DiscHeader.hyphen5 mask byte is incorrect.");
+	uint64_t chk1, chk2;
+	memcpy(&chk1, &wiiu_header->hyphen1, sizeof(chk1));	// bytes 3-10: hyphen1, hyphen2, hyphen3
+	memcpy(&chk2, &wiiu_header->hyphen4, sizeof(chk2));	// bytes 13-20: hyphen4, hyphen5
+	if ((chk1 & cpu_to_le64(0xFF00000000FF00FFULL)) != cpu_to_le64(0x2D000000002D002DULL) ||
+	    (chk2 & cpu_to_le64(0xFF000000000000FFULL)) != cpu_to_le64(0x2D0000000000002DULL))
 	{
 		// Missing hyphen.
 		return -1;
@@ -460,23 +465,23 @@ int WiiU::loadFieldData(void)
 	}
 
 	// Disc header is read in the constructor.
-	d->fields->reserve(4);	// Maximum of 4 fields.
+	d->fields->reserve(5);	// Maximum of 5 fields.
 
 	// Game ID.
 	d->fields->addField_string(C_("WiiU", "Game ID"),
 		latin1_to_utf8(d->discHeader.id, sizeof(d->discHeader.id)));
 
 	// Publisher.
-	// Look up the publisher ID.
+	// NOTE: Publisher ID is looked up in the constructor.
 	char publisher_code[5];
 	const char *publisher = nullptr;
 	string s_publisher;
 
-	const uint32_t publisher_id = WiiUData::lookup_disc_publisher(d->discHeader.id4);
-	publisher_code[0] = (publisher_id >> 24) & 0xFF;
-	publisher_code[1] = (publisher_id >> 16) & 0xFF;
-	publisher_code[2] = (publisher_id >>  8) & 0xFF;
-	publisher_code[3] =  publisher_id & 0xFF;
+	const uint32_t publisher_id = d->publisher_id;
+	// The publisher code is the big-endian representation
+	// of the publisher ID, so store it as one 32-bit value.
+	const uint32_t publisher_be = cpu_to_be32(publisher_id);
+	memcpy(publisher_code, &publisher_be, sizeof(publisher_be));
 	publisher_code[4] = 0;
 	if (publisher_id != 0 && (publisher_id & 0xFFFF0000) == 0x30300000) {
 		// Publisher ID is a valid two-character ID.
@@ -505,12 +510,16 @@ int WiiU::loadFieldData(void)
 		latin1_to_utf8(d->discHeader.version, sizeof(d->discHeader.version)));
 
 	// OS version.
+	// NOTE: Always "X.Y.Z", so build the string directly
+	// instead of going through rp_sprintf().
 	// TODO: Validate the version characters.
+	const char os_version[5] = {
+		d->discHeader.os_version[0], '.',
+		d->discHeader.os_version[1], '.',
+		d->discHeader.os_version[2],
+	};
 	d->fields->addField_string(C_("WiiU", "OS Version"),
-		rp_sprintf("%c.%c.%c",
-			d->discHeader.os_version[0],
-			d->discHeader.os_version[1],
-			d->discHeader.os_version[2]));
+		string(os_version, sizeof(os_version)));
 
 	// Region.
 	// TODO: Compare against list of regions and show the fancy name.
@@ -597,8 +606,8 @@ int WiiU::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) const
 			return -ENOENT;
 	}
 
-	// Look up the publisher ID.
-	uint32_t publisher_id = WiiUData::lookup_disc_publisher(d->discHeader.id4);
+	// Publisher ID is looked up in the constructor.
+	const uint32_t publisher_id = d->publisher_id;
 	if (publisher_id == 0 || (publisher_id & 0xFFFF0000) != 0x30300000) {
 		// Either the publisher ID is unknown, or it's a
 		// 4-character ID, which isn't supported by
@@ -609,8 +618,8 @@ int WiiU::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) const
 	// Determine the GameTDB region code(s).
 	// TODO: Wii U version. (Figure out the region code field...)
 	//vector<const char*> tdb_regions = d->gcnRegionToGameTDB(d->gcnRegion, d->discHeader.id4[3]);
-	vector<const char*> tdb_regions;
-	tdb_regions.push_back("US");
+	// NOTE: Hard-coded to "US" for now, so no vector is needed.
+	static const char *const tdb_regions[] = {"US"};
 
 	// Game ID.
 	// Replace any non-printable characters with underscores.
@@ -622,9 +631,9 @@ int WiiU::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) const
 			: '_');
 	}
 
-	// Publisher ID.
-	id6[4] = (publisher_id >> 8) & 0xFF;
-	id6[5] = publisher_id & 0xFF;
+	// Publisher ID. (Low 16 bits, big-endian.)
+	const uint16_t publisher_be16 = cpu_to_be16(static_cast<uint16_t>(publisher_id));
+	memcpy(&id6[4], &publisher_be16, sizeof(publisher_be16));
 	id6[6] = 0;
 
 	// If we're downloading a "high-resolution" image (M or higher),
@@ -643,20 +652,28 @@ int WiiU::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) const
 	}
 
 	// Add the URLs.
-	pExtURLs->resize(szdef_count * tdb_regions.size());
+	pExtURLs->resize(szdef_count * ARRAY_SIZE(tdb_regions));
 	auto extURL_iter = pExtURLs->begin();
 	for (unsigned int i = 0; i < szdef_count; i++) {
 		// Current image type.
+		// NOTE: Only needs to be formatted if the size has a
+		// name suffix; the default size uses the base name as-is.
 		char imageTypeName[16];
-		snprintf(imageTypeName, sizeof(imageTypeName), "%s%s",
-			 imageTypeName_base, (szdefs_dl[i]->name ? szdefs_dl[i]->name : ""));
+		const char *pImageTypeName;
+		if (szdefs_dl[i]->name) {
+			snprintf(imageTypeName, sizeof(imageTypeName), "%s%s",
+				 imageTypeName_base, szdefs_dl[i]->name);
+			pImageTypeName = imageTypeName;
+		} else {
+			pImageTypeName = imageTypeName_base;
+		}
 
 		// Add the images.
-		for (auto tdb_iter = tdb_regions.cbegin();
-		     tdb_iter != tdb_regions.cend(); ++tdb_iter, ++extURL_iter)
+		for (const char *const *tdb_iter = tdb_regions;
+		     tdb_iter != &tdb_regions[ARRAY_SIZE(tdb_regions)]; ++tdb_iter, ++extURL_iter)
 		{
-			extURL_iter->url = d->getURL_GameTDB("wiiu", imageTypeName, *tdb_iter, id6, ext);
-			extURL_iter->cache_key = d->getCacheKey_GameTDB("wiiu", imageTypeName, *tdb_iter, id6, ext);
+			extURL_iter->url = d->getURL_GameTDB("wiiu", pImageTypeName, *tdb_iter, id6, ext);
+			extURL_iter->cache_key = d->getCacheKey_GameTDB("wiiu", pImageTypeName, *tdb_iter, id6, ext);
 			extURL_iter->width = szdefs_dl[i]->width;
 			extURL_iter->height = szdefs_dl[i]->height;
 			extURL_iter->high_res = (szdefs_dl[i]->index > 0);
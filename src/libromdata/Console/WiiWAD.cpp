@@ -52,7 +52,6 @@ using namespace LibRpBase;
 #include <string>
 #include <vector>
 using std::string;
-using std::unique_ptr;
 using std::vector;
 
 namespace LibRomData {
@@ -98,13 +97,14 @@ class WiiWADPrivate : public RomDataPrivate
 
 		/**
 		 * Round a value to the next highest multiple of 64.
+		 * NOTE: All callers pass 32-bit unsigned section sizes,
+		 * so there's no need for this to be a template.
 		 * @param value Value.
 		 * @return Next highest multiple of 64.
 		 */
-		template<typename T>
-		static inline T toNext64(T val)
+		static inline uint32_t toNext64(uint32_t val)
 		{
-			return (val + (T)63) & ~((T)63);
+			return (val + 63U) & ~63U;
 		}
 
 #ifdef ENABLE_DECRYPTION
@@ -115,6 +115,25 @@ class WiiWADPrivate : public RomDataPrivate
 		// Main data headers.
 		Wii_Content_Bin_Header contentHeader;
 		Wii_IMET_t imet;	// NOTE: May be WIBN.
+
+		// Has the data area been initialized?
+		bool dataAreaInit;
+
+		// Cached game info string. (from the IMET header)
+		// NOTE: getGameInfo() is called by both loadFieldData()
+		// and loadMetaData(), so the decoded string is cached.
+		string gameInfo;
+		bool gameInfoLoaded;
+
+		/**
+		 * Initialize the CBC reader for the main data area,
+		 * then read the content and IMET headers.
+		 *
+		 * The constructor only reads the WAD header, ticket,
+		 * and TMD. This function is called on demand the first
+		 * time the decrypted data area is actually needed.
+		 */
+		void initDataArea(void);
 #endif /* ENABLE_DECRYPTION */
 
 		// Key index.
@@ -139,16 +158,19 @@ WiiWADPrivate::WiiWADPrivate(WiiWAD *q, IRpFile *file)
 #ifdef ENABLE_DECRYPTION
 	, cbcReader(nullptr)
 	, wibnData(nullptr)
+	, dataAreaInit(false)
+	, gameInfoLoaded(false)
 #endif /* ENABLE_DECRYPTION */
 	, key_idx(WiiPartition::Key_Max)
 	, key_status(KeyManager::VERIFY_UNKNOWN)
 {
-	// Clear the various structs.
-	memset(&wadHeader, 0, sizeof(wadHeader));
-	memset(&ticket, 0, sizeof(ticket));
-	memset(&tmdHeader, 0, sizeof(tmdHeader));
+	// NOTE: wadHeader, ticket, and tmdHeader are only read after
+	// they've been loaded from the file, so they don't need to be
+	// cleared here.
 
 #ifdef ENABLE_DECRYPTION
+	// contentHeader and imet may be checked even if reading them
+	// failed, so these do need to be cleared.
 	memset(&contentHeader, 0, sizeof(contentHeader));
 	memset(&imet, 0, sizeof(imet));
 #endif /* ENABLE_DECRYPTION */
@@ -164,6 +186,122 @@ WiiWADPrivate::~WiiWADPrivate()
 #endif /* ENABLE_DECRYPTION */
 }
 
+#ifdef ENABLE_DECRYPTION
+/**
+ * Initialize the CBC reader for the main data area,
+ * then read the content and IMET headers.
+ *
+ * The constructor only reads the WAD header, ticket,
+ * and TMD. This function is called on demand the first
+ * time the decrypted data area is actually needed.
+ */
+void WiiWADPrivate::initDataArea(void)
+{
+	if (dataAreaInit) {
+		// Data area has already been initialized,
+		// or a previous attempt failed.
+		return;
+	}
+	dataAreaInit = true;
+
+	if (!file || !file->isOpen() || !isValid) {
+		// Can't read the data area.
+		return;
+	}
+
+	// TODO: WiiVerifyKeys class.
+	KeyManager *const keyManager = KeyManager::instance();
+	assert(keyManager != nullptr);
+
+	// Key verification data.
+	// TODO: Move out of WiiPartition and into WiiVerifyKeys?
+	const char *const keyName = WiiPartition::encryptionKeyName_static(key_idx);
+	const uint8_t *const verifyData = WiiPartition::encryptionVerifyData_static(key_idx);
+	assert(keyName != nullptr);
+	assert(keyName[0] != '\0');
+	assert(verifyData != nullptr);
+
+	// Get and verify the key.
+	KeyManager::KeyData_t keyData;
+	key_status = keyManager->getAndVerify(keyName, &keyData, verifyData, 16);
+	if (key_status != KeyManager::VERIFY_OK) {
+		// Unable to get and verify the key.
+		return;
+	}
+
+	// Create a cipher to decrypt the title key.
+	IAesCipher *cipher = AesCipherFactory::create();
+
+	// Initialize parameters for title key decryption.
+	// TODO: Error checking.
+	// Parameters:
+	// - Chaining mode: CBC
+	// - IV: Title ID (little-endian)
+	cipher->setChainingMode(IAesCipher::CM_CBC);
+	cipher->setKey(keyData.key, keyData.length);
+	// Title key IV: High 8 bytes are the title ID (in big-endian), low 8 bytes are 0.
+	uint8_t iv[16];
+	memcpy(iv, &ticket.title_id.id, sizeof(ticket.title_id.id));
+	memset(&iv[8], 0, 8);
+	cipher->setIV(iv, sizeof(iv));
+	
+	// Decrypt the title key.
+	uint8_t title_key[16];
+	memcpy(title_key, ticket.enc_title_key, sizeof(ticket.enc_title_key));
+	cipher->decrypt(title_key, sizeof(title_key));
+	delete cipher;
+
+	// Data area IV:
+	// - First two bytes are the big-endian content index.
+	// - Remaining bytes are zero.
+	// - TODO: Read the TMD content table. For now, assuming index 0.
+	memset(iv, 0, sizeof(iv));
+
+	// Create a CBC reader to decrypt the data section.
+	// TODO: Verify some known data?
+	cbcReader = new CBCReader(file, data_offset, data_size, title_key, iv);
+
+	// Read the content header.
+	// NOTE: Continuing even if this fails, since we can show
+	// other information from the ticket and TMD.
+	size_t size = cbcReader->read(&contentHeader, sizeof(contentHeader));
+	if (size == sizeof(contentHeader)) {
+		// Contents may be one of the following:
+		// - IMET header: Most common.
+		// - WIBN header: DLC titles.
+		size = cbcReader->read(&imet, sizeof(imet));
+		if (size == sizeof(imet)) {
+			// TODO: Use the WiiWIBN subclass.
+			// TODO: Create a WiiIMET subclass? (and also use it in GameCube)
+			if (imet.magic == cpu_to_be32(WII_IMET_MAGIC)) {
+				// This is an IMET header.
+				// TODO: Do something here?
+			} else if (imet.magic == cpu_to_be32(WII_WIBN_MAGIC)) {
+				// This is a WIBN header.
+				// Create the PartitionFile and WiiWIBN subclass.
+				// NOTE: Not sure how big the WIBN data is, so we'll
+				// allow it to read the rest of the file.
+				PartitionFile *const ptFile = new PartitionFile(cbcReader,
+					sizeof(contentHeader),
+					data_size - sizeof(contentHeader));
+				if (ptFile->isOpen()) {
+					// Open the WiiWIBN.
+					WiiWIBN *const wibn = new WiiWIBN(ptFile);
+					if (wibn->isOpen()) {
+						// Opened successfully.
+						wibnData = wibn;
+					} else {
+						// Unable to open the WiiWIBN.
+						wibn->unref();
+					}
+				}
+				ptFile->unref();
+			}
+		}
+	}
+}
+#endif /* ENABLE_DECRYPTION */
+
 /**
  * Get the game information string from the banner.
  * @return Game information string, or empty string on error.
@@ -171,8 +309,16 @@ WiiWADPrivate::~WiiWADPrivate()
 string WiiWADPrivate::getGameInfo(void)
 {
 #ifdef ENABLE_DECRYPTION
+	if (gameInfoLoaded) {
+		// Game info has already been loaded.
+		return gameInfo;
+	}
+	gameInfoLoaded = true;
+
 	// IMET header.
-	// TODO: Read on demand instead of always reading in the constructor.
+	// NOTE: Read on demand, since the data area isn't
+	// decrypted in the constructor.
+	initDataArea();
 	if (imet.magic != cpu_to_be32(WII_IMET_MAGIC)) {
 		// Not valid.
 		return string();
@@ -194,13 +340,13 @@ string WiiWADPrivate::getGameInfo(void)
 	// NOTE: The banner may have two lines.
 	// Each line is a maximum of 21 characters.
 	// Convert from UTF-16 BE and split into two lines at the same time.
-	string info = utf16be_to_utf8(imet.names[lang][0], 21);
+	gameInfo = utf16be_to_utf8(imet.names[lang][0], 21);
 	if (imet.names[lang][1][0] != 0) {
-		info += '\n';
-		info += utf16be_to_utf8(imet.names[lang][1], 21);
+		gameInfo += '\n';
+		gameInfo += utf16be_to_utf8(imet.names[lang][1], 21);
 	}
 
-	return info;
+	return gameInfo;
 #else /* !ENABLE_DECRYPTION */
 	// Unable to decrypt the IMET header.
 	return string();
@@ -236,8 +382,7 @@ WiiWAD::WiiWAD(IRpFile *file)
 	}
 
 	// Read the WAD header.
-	d->file->rewind();
-	size_t size = d->file->read(&d->wadHeader, sizeof(d->wadHeader));
+	size_t size = d->file->seekAndRead(0, &d->wadHeader, sizeof(d->wadHeader));
 	if (size != sizeof(d->wadHeader)) {
 		d->file->unref();
 		d->file = nullptr;
@@ -291,14 +436,16 @@ WiiWAD::WiiWAD(IRpFile *file)
 			d->data_size = (uint32_t)d->file->size() - d->data_offset;
 
 			// Read the name here, since it's only present in early WADs.
+			// NOTE: The name is bounded at 1 KB, so a stack buffer
+			// is sufficient; no need for a heap allocation.
 			const uint32_t name_size = be32_to_cpu(d->wadHeader.wadE.name_size);
 			if (name_size > 0 && name_size <= 1024) {
 				const uint32_t name_addr = tmd_addr + be32_to_cpu(d->wadHeader.wadE.tmd_size);
-				unique_ptr<char[]> namebuf(new char[name_size]);
-				size = d->file->seekAndRead(name_addr, namebuf.get(), name_size);
+				char namebuf[1024];
+				size = d->file->seekAndRead(name_addr, namebuf, name_size);
 				if (size == name_size) {
 					// TODO: Trim NULLs?
-					d->wadName = string(namebuf.get(), name_size);
+					d->wadName = string(namebuf, name_size);
 				}
 			}
 			break;
@@ -345,103 +492,13 @@ WiiWAD::WiiWAD(IRpFile *file)
 		d->key_idx = (WiiPartition::EncryptionKeys)idx;
 	}
 
-#ifdef ENABLE_DECRYPTION
-	// Initialize the CBC reader for the main data area.
-
-	// TODO: WiiVerifyKeys class.
-	KeyManager *const keyManager = KeyManager::instance();
-	assert(keyManager != nullptr);
-
-	// Key verification data.
-	// TODO: Move out of WiiPartition and into WiiVerifyKeys?
-	const char *const keyName = WiiPartition::encryptionKeyName_static(d->key_idx);
-	const uint8_t *const verifyData = WiiPartition::encryptionVerifyData_static(d->key_idx);
-	assert(keyName != nullptr);
-	assert(keyName[0] != '\0');
-	assert(verifyData != nullptr);
-
-	// Get and verify the key.
-	KeyManager::KeyData_t keyData;
-	d->key_status = keyManager->getAndVerify(keyName, &keyData, verifyData, 16);
-	if (d->key_status != KeyManager::VERIFY_OK) {
-		// Unable to get and verify the key.
-		return;
-	}
-
-	// Create a cipher to decrypt the title key.
-	IAesCipher *cipher = AesCipherFactory::create();
-
-	// Initialize parameters for title key decryption.
-	// TODO: Error checking.
-	// Parameters:
-	// - Chaining mode: CBC
-	// - IV: Title ID (little-endian)
-	cipher->setChainingMode(IAesCipher::CM_CBC);
-	cipher->setKey(keyData.key, keyData.length);
-	// Title key IV: High 8 bytes are the title ID (in big-endian), low 8 bytes are 0.
-	uint8_t iv[16];
-	memcpy(iv, &d->ticket.title_id.id, sizeof(d->ticket.title_id.id));
-	memset(&iv[8], 0, 8);
-	cipher->setIV(iv, sizeof(iv));
-	
-	// Decrypt the title key.
-	uint8_t title_key[16];
-	memcpy(title_key, d->ticket.enc_title_key, sizeof(d->ticket.enc_title_key));
-	cipher->decrypt(title_key, sizeof(title_key));
-	delete cipher;
-
-	// Data area IV:
-	// - First two bytes are the big-endian content index.
-	// - Remaining bytes are zero.
-	// - TODO: Read the TMD content table. For now, assuming index 0.
-	memset(iv, 0, sizeof(iv));
-
-	// Create a CBC reader to decrypt the data section.
-	// TODO: Verify some known data?
-	d->cbcReader = new CBCReader(d->file, d->data_offset, d->data_size, title_key, iv);
-
-	// Read the content header.
-	// NOTE: Continuing even if this fails, since we can show
-	// other information from the ticket and TMD.
-	size = d->cbcReader->read(&d->contentHeader, sizeof(d->contentHeader));
-	if (size == sizeof(d->contentHeader)) {
-		// Contents may be one of the following:
-		// - IMET header: Most common.
-		// - WIBN header: DLC titles.
-		size = d->cbcReader->read(&d->imet, sizeof(d->imet));
-		if (size == sizeof(d->imet)) {
-			// TODO: Use the WiiWIBN subclass.
-			// TODO: Create a WiiIMET subclass? (and also use it in GameCube)
-			if (d->imet.magic == cpu_to_be32(WII_IMET_MAGIC)) {
-				// This is an IMET header.
-				// TODO: Do something here?
-			} else if (d->imet.magic == cpu_to_be32(WII_WIBN_MAGIC)) {
-				// This is a WIBN header.
-				// Create the PartitionFile and WiiWIBN subclass.
-				// NOTE: Not sure how big the WIBN data is, so we'll
-				// allow it to read the rest of the file.
-				PartitionFile *const ptFile = new PartitionFile(d->cbcReader,
-					sizeof(d->contentHeader),
-					d->data_size - sizeof(d->contentHeader));
-				if (ptFile->isOpen()) {
-					// Open the WiiWIBN.
-					WiiWIBN *const wibn = new WiiWIBN(ptFile);
-					if (wibn->isOpen()) {
-						// Opened successfully.
-						d->wibnData = wibn;
-					} else {
-						// Unable to open the WiiWIBN.
-						wibn->unref();
-					}
-				}
-				ptFile->unref();
-			}
-		}
-	}
-#else /* !ENABLE_DECRYPTION */
+#ifndef ENABLE_DECRYPTION
 	// Cannot decrypt anything...
 	d->key_status = KeyManager::VERIFY_NO_SUPPORT;
-#endif /* ENABLE_DECRYPTION */
+#endif /* !ENABLE_DECRYPTION */
+
+	// NOTE: The CBC reader and the content/IMET headers are
+	// initialized on demand in WiiWADPrivate::initDataArea().
 }
 
 /**
@@ -700,6 +757,12 @@ int WiiWAD::loadFieldData(void)
 		return -EIO;
 	}
 
+#ifdef ENABLE_DECRYPTION
+	// Make sure the data area has been initialized.
+	// (Needed for the key status and the WIBN/IMET data.)
+	d->initDataArea();
+#endif /* ENABLE_DECRYPTION */
+
 	// WAD headers are read in the constructor.
 	const RVL_TMD_Header *const tmdHeader = &d->tmdHeader;
 	d->fields->reserve(11);	// Maximum of 11 fields.
@@ -743,10 +806,13 @@ int WiiWAD::loadFieldData(void)
 
 	// Title ID.
 	// TODO: Make sure the ticket title ID matches the TMD title ID.
-	d->fields->addField_string(C_("WiiWAD", "Title ID"),
-		rp_sprintf("%08X-%08X",
-			be32_to_cpu(tmdHeader->title_id.hi),
-			be32_to_cpu(tmdHeader->title_id.lo)));
+	// NOTE: Fixed-width format, so snprintf() is used directly
+	// instead of rp_sprintf().
+	char buf[32];
+	int len = snprintf(buf, sizeof(buf), "%08X-%08X",
+		be32_to_cpu(tmdHeader->title_id.hi),
+		be32_to_cpu(tmdHeader->title_id.lo));
+	d->fields->addField_string(C_("WiiWAD", "Title ID"), string(buf, len));
 
 	// Game ID.
 	// NOTE: Only displayed if TID lo is all alphanumeric characters.
@@ -758,14 +824,17 @@ int WiiWAD::loadFieldData(void)
 	{
 		// Print the game ID.
 		// TODO: Is the publisher code available anywhere?
+		// NOTE: All four characters are alphanumeric, so no
+		// formatting is needed.
 		d->fields->addField_string(C_("WiiWAD", "Game ID"),
-			rp_sprintf("%.4s", reinterpret_cast<const char*>(&tmdHeader->title_id.u8[4])));
+			string(reinterpret_cast<const char*>(&tmdHeader->title_id.u8[4]), 4));
 	}
 
 	// Title version.
 	const uint16_t title_version = be16_to_cpu(tmdHeader->title_version);
-	d->fields->addField_string(C_("WiiWAD", "Title Version"),
-		rp_sprintf("%u.%u (v%u)", title_version >> 8, title_version & 0xFF, title_version));
+	len = snprintf(buf, sizeof(buf), "%u.%u (v%u)",
+		title_version >> 8, title_version & 0xFF, title_version);
+	d->fields->addField_string(C_("WiiWAD", "Title Version"), string(buf, len));
 
 	// Title ID constants.
 	const uint32_t tid_hi = be32_to_cpu(tmdHeader->title_id.hi);
@@ -846,15 +915,15 @@ int WiiWAD::loadFieldData(void)
 	    ios_lo > 2 && ios_lo < 0x300)
 	{
 		// Standard IOS slot.
-		d->fields->addField_string(ios_version_title,
-			rp_sprintf("IOS%u", ios_lo));
+		len = snprintf(buf, sizeof(buf), "IOS%u", ios_lo);
+		d->fields->addField_string(ios_version_title, string(buf, len));
 	} else if (tmdHeader->sys_version.id != 0) {
 		// Non-standard IOS slot.
 		// Print the full title ID.
-		d->fields->addField_string(ios_version_title,
-			rp_sprintf("%08X-%08X",
-				be32_to_cpu(tmdHeader->sys_version.hi),
-				be32_to_cpu(tmdHeader->sys_version.lo)));
+		len = snprintf(buf, sizeof(buf), "%08X-%08X",
+			be32_to_cpu(tmdHeader->sys_version.hi),
+			be32_to_cpu(tmdHeader->sys_version.lo));
+		d->fields->addField_string(ios_version_title, string(buf, len));
 	}
 
 	// Access rights.
@@ -1016,6 +1085,7 @@ int WiiWAD::loadInternalImage(ImageType imageType, const rp_image **pImage)
 
 #ifdef ENABLE_DECRYPTION
 	// Forward this call to the WiiWIBN object.
+	d->initDataArea();
 	if (d->wibnData) {
 		return d->wibnData->loadInternalImage(imageType, pImage);
 	}
@@ -1039,6 +1109,7 @@ const IconAnimData *WiiWAD::iconAnimData(void) const
 #ifdef ENABLE_DECRYPTION
 	// Forward this call to the WiiWIBN object.
 	RP_D(const WiiWAD);
+	const_cast<WiiWADPrivate*>(d)->initDataArea();
 	if (d->wibnData) {
 		return d->wibnData->iconAnimData();
 	}
@@ -1072,11 +1143,15 @@ int WiiWAD::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) con
 	// If it is, this is a DLC WAD, so the title ID
 	// won't match anything on GameTDB.
 	RP_D(const WiiWAD);
-	if (!d->isValid || d->wadType < 0) {
+	if (unlikely(!d->isValid || d->wadType < 0)) {
 		// WAD isn't valid.
 		return -EIO;
-	} else
+	}
+
 #ifdef ENABLE_DECRYPTION
+	// Make sure the data area has been initialized,
+	// since we need to check for a WiiWIBN.
+	const_cast<WiiWADPrivate*>(d)->initDataArea();
 	if (d->wibnData) {
 		// WiiWIBN is present.
 		// This means the boxart is not available on GameTDB,
@@ -1088,7 +1163,9 @@ int WiiWAD::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) con
 		// If the first letter of the ID4 is lowercase,
 		// that means it's a DLC title. GameTDB doesn't
 		// have artwork for DLC titles.
-		char sysID = be32_to_cpu(d->tmdHeader.title_id.lo) >> 24;
+		// NOTE: The first byte of the big-endian TID lo can be
+		// read directly; no need to byteswap the whole DWORD.
+		const char sysID = (char)d->tmdHeader.title_id.u8[4];
 		if (ISLOWER(sysID)) {
 			// It's lowercase.
 			return -ENOENT;
@@ -1099,32 +1176,47 @@ int WiiWAD::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) con
 	const RVL_TMD_Header *const tmdHeader = &d->tmdHeader;
 
 	// Check for a valid TID hi.
-	switch (be32_to_cpu(tmdHeader->title_id.hi)) {
-		case 0x00010000:
-		case 0x00010001:
-		case 0x00010002:
-		case 0x00010004:
-		case 0x00010005:
-		case 0x00010008:
-			// TID hi is valid.
-			break;
+	// Valid values: 0x00010000, 0x00010001, 0x00010002,
+	//               0x00010004, 0x00010005, 0x00010008
+	// All of them are 0x0001000X, so verify the high bits first,
+	// then check the low nibble against a bitmask.
+	static const uint16_t valid_tid_hi_mask =
+		(1U << 0) | (1U << 1) | (1U << 2) |
+		(1U << 4) | (1U << 5) | (1U << 8);
+	const uint32_t tid_hi = be32_to_cpu(tmdHeader->title_id.hi);
+	if ((tid_hi & ~0xFU) != 0x00010000 ||
+	    !((valid_tid_hi_mask >> (tid_hi & 0xFU)) & 1))
+	{
+		// No GameTDB artwork is available.
+		return -ENOENT;
+	}
 
-		default:
-			// No GameTDB artwork is available.
+	// Game ID. (GameTDB uses ID4 for WiiWare.)
+	// The ID4 cannot have non-printable characters.
+	// NOTE: Must be NULL-terminated.
+	// NOTE: Checked before the image size lookup because it's
+	// cheaper than building and sorting the size vector.
+	char id4[5];
+	memcpy(id4, &tmdHeader->title_id.u8[4], 4);
+	id4[4] = 0;
+	for (int i = 4-1; i >= 0; i--) {
+		if (!ISPRINT(id4[i])) {
+			// Non-printable character found.
 			return -ENOENT;
+		}
 	}
 
 	// Get the image sizes and sort them based on the
 	// requested image size.
 	vector<ImageSizeDef> sizeDefs = supportedImageSizes(imageType);
-	if (sizeDefs.empty()) {
+	if (unlikely(sizeDefs.empty())) {
 		// No image sizes.
 		return -ENOENT;
 	}
 
 	// Select the best size.
 	const ImageSizeDef *const sizeDef = d->selectBestSize(sizeDefs, size);
-	if (!sizeDef) {
+	if (unlikely(!sizeDef)) {
 		// No size available...
 		return -ENOENT;
 	}
@@ -1160,19 +1252,6 @@ int WiiWAD::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) con
 			return -ENOENT;
 	}
 
-	// Game ID. (GameTDB uses ID4 for WiiWare.)
-	// The ID4 cannot have non-printable characters.
-	// NOTE: Must be NULL-terminated.
-	char id4[5];
-	memcpy(id4, &tmdHeader->title_id.u8[4], 4);
-	id4[4] = 0;
-	for (int i = 4-1; i >= 0; i--) {
-		if (!ISPRINT(id4[i])) {
-			// Non-printable character found.
-			return -ENOENT;
-		}
-	}
-
 	// Determine the GameTDB region code(s).
 	const unsigned int gcnRegion = be16_to_cpu(tmdHeader->region_code);
 	const char id4_region = (char)tmdHeader->title_id.u8[7];
@@ -1200,18 +1279,31 @@ int WiiWAD::extURLs(ImageType imageType, vector<ExtURL> *pExtURLs, int size) con
 	for (unsigned int i = 0; i < szdef_count; i++) {
 		// Current image type.
 		char imageTypeName[16];
-		snprintf(imageTypeName, sizeof(imageTypeName), "%s%s",
-			 imageTypeName_base, (szdefs_dl[i]->name ? szdefs_dl[i]->name : ""));
+		const char *pImageTypeName;
+		if (szdefs_dl[i]->name) {
+			// Size suffix is present.
+			snprintf(imageTypeName, sizeof(imageTypeName), "%s%s",
+				 imageTypeName_base, szdefs_dl[i]->name);
+			pImageTypeName = imageTypeName;
+		} else {
+			// No size suffix. Use the base name directly.
+			pImageTypeName = imageTypeName_base;
+		}
+
+		// These are the same for all regions of this image size.
+		const int width = szdefs_dl[i]->width;
+		const int height = szdefs_dl[i]->height;
+		const bool high_res = (szdefs_dl[i]->index >= 2);
 
 		// Add the images.
 		for (auto tdb_iter = tdb_regions.cbegin();
 		     tdb_iter != tdb_regions.cend(); ++tdb_iter, ++extURL_iter)
 		{
-			extURL_iter->url = d->getURL_GameTDB("wii", imageTypeName, *tdb_iter, id4, ext);
-			extURL_iter->cache_key = d->getCacheKey_GameTDB("wii", imageTypeName, *tdb_iter, id4, ext);
-			extURL_iter->width = szdefs_dl[i]->width;
-			extURL_iter->height = szdefs_dl[i]->height;
-			extURL_iter->high_res = (szdefs_dl[i]->index >= 2);
+			extURL_iter->url = d->getURL_GameTDB("wii", pImageTypeName, *tdb_iter, id4, ext);
+			extURL_iter->cache_key = d->getCacheKey_GameTDB("wii", pImageTypeName, *tdb_iter, id4, ext);
+			extURL_iter->width = width;
+			extURL_iter->height = height;
+			extURL_iter->high_res = high_res;
 		}
 	}
 
@@ -24,6 +24,7 @@ using namespace LibRpBase;
 
 // C includes. (C++ namespace)
 #include <cassert>
+#include <cstring>
 #include <cerrno>
 
 // C++ includes.
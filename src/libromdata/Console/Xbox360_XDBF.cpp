@@ -31,18 +31,17 @@ using namespace LibRpBase;
 // C includes. (C++ namespace)
 #include <cassert>
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 
 // C++ includes.
 #include <memory>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 using std::string;
 using std::unique_ptr;
 using std::unordered_map;
-using std::unordered_set;
 using std::vector;
 
 // Uninitialized vector class.
@@ -58,6 +57,14 @@ ROMDATA_IMPL_IMG_SIZES(Xbox360_XDBF)
 // Workaround for RP_D() expecting the no-underscore naming convention.
 #define Xbox360_XDBFPrivate Xbox360_XDBF_Private
 
+// Maximum resource ID that fits in the composite resource map key.
+// All known XDBF resource IDs fit in 48 bits.
+static const uint64_t XDBF_RES_MAP_ID_MASK = 0xFFFFFFFFFFFFULL;
+
+// Maximum data area size to preload. (4 MB)
+// Larger data areas are read on demand.
+static const uint32_t XDBF_DATA_PRELOAD_MAX = 4*1024*1024;
+
 class Xbox360_XDBF_Private : public RomDataPrivate
 {
 	public:
@@ -87,11 +94,33 @@ class Xbox360_XDBF_Private : public RomDataPrivate
 		// NOTE: Data is *not* byteswapped on load.
 		XDBF_Entry *entryTable;
 
+		// Resource map.
+		// - Key: Namespace ID in the high 16 bits;
+		//        resource ID in the low 48 bits.
+		// - Value: Pointer into entryTable.
+		// If empty, findResource() falls back to a linear scan.
+		unordered_map<uint64_t, const XDBF_Entry*> map_resources;
+
 		// Data start offset within the file.
 		uint32_t data_offset;
 
+		// Preloaded data area.
+		// If the data area is small enough, it's read in one go
+		// so individual resource loads don't have to seek.
+		// If empty, resources are read from the file directly.
+		ao::uvector<uint8_t> dataBlob;
+
 		// Cached language ID.
+		// NOTE: If m_langID_resolved is true, m_langID is valid,
+		// even if it's XDBF_LANGUAGE_UNKNOWN. (resolution failed)
 		XDBF_Language_e m_langID;
+		bool m_langID_resolved;
+
+		// Cached XTHD title type index.
+		// NOTE: If m_titleType_resolved is true, m_titleType is
+		// valid, even if it's -1. (XTHD missing or invalid)
+		int m_titleType;
+		bool m_titleType_resolved;
 
 		// If true, this XDBF section is in an XEX executable.
 		// Some fields shouldn't be displayed.
@@ -101,6 +130,19 @@ class Xbox360_XDBF_Private : public RomDataPrivate
 		// NOTE: These are *pointers* to ao::uvector<>.
 		ao::uvector<char> *strTbl[XDBF_LANGUAGE_MAX];
 
+		// String table indexes.
+		// Built once per string table by loadStringTable().
+		// - Key: String ID (big-endian, as stored in the table)
+		// - Value: {offset of the string data, length}
+		unordered_map<uint16_t, std::pair<uint32_t, uint16_t> > strTblIdx[XDBF_LANGUAGE_MAX];
+
+		// Decoded string cache.
+		// Achievements frequently share description strings,
+		// so cache the dos2unix() result per string.
+		// - Key: (language_id << 16) | string_id
+		// - Value: Decoded string
+		unordered_map<uint32_t, string> map_strCache;
+
 		/**
 		 * Find a resource in the entry table.
 		 * @param namespace_id Namespace ID.
@@ -109,6 +151,17 @@ class Xbox360_XDBF_Private : public RomDataPrivate
 		 */
 		const XDBF_Entry *findResource(uint16_t namespace_id, uint64_t resource_id) const;
 
+		/**
+		 * Read data from the XDBF data area.
+		 * Uses the preloaded data blob if available;
+		 * otherwise, reads directly from the file.
+		 * @param addr Address within the file.
+		 * @param buf Output buffer.
+		 * @param size Amount to read.
+		 * @return Number of bytes read.
+		 */
+		size_t readData(uint32_t addr, void *buf, size_t size) const;
+
 		/**
 		 * Load a string table.
 		 * @param language_id Language ID.
@@ -130,6 +183,17 @@ class Xbox360_XDBF_Private : public RomDataPrivate
 		 */
 		XDBF_Language_e getLangID(void) const;
 
+	private:
+		/**
+		 * Resolve the language ID for the title fields.
+		 * Called by getLangID() the first time it's needed;
+		 * use getLangID() instead of calling this directly.
+		 * @return XDBF language ID, or XDBF_LANGUAGE_UNKNOWN on error.
+		 */
+		XDBF_Language_e resolveLangID(void);
+
+	public:
+
 		/**
 		 * Load an image resource.
 		 * @param image_id Image ID.
@@ -178,6 +242,9 @@ Xbox360_XDBF_Private::Xbox360_XDBF_Private(Xbox360_XDBF *q, IRpFile *file, bool
 	, entryTable(nullptr)
 	, data_offset(0)
 	, m_langID(XDBF_LANGUAGE_UNKNOWN)
+	, m_langID_resolved(false)
+	, m_titleType(-1)
+	, m_titleType_resolved(false)
 	, xex(xex)
 {
 	// Clear the header.
@@ -215,6 +282,13 @@ const XDBF_Entry *Xbox360_XDBF_Private::findResource(uint16_t namespace_id, uint
 		return nullptr;
 	}
 
+	if (!map_resources.empty() && resource_id <= XDBF_RES_MAP_ID_MASK) {
+		// Look it up in the resource map.
+		const uint64_t key = (static_cast<uint64_t>(namespace_id) << 48) | resource_id;
+		auto iter = map_resources.find(key);
+		return (iter != map_resources.end() ? iter->second : nullptr);
+	}
+
 #if SYS_BYTEORDER == SYS_LIL_ENDIAN
 	// Byteswap the IDs to make it easier to find things.
 	namespace_id = cpu_to_be16(namespace_id);
@@ -236,6 +310,36 @@ const XDBF_Entry *Xbox360_XDBF_Private::findResource(uint16_t namespace_id, uint
 	return nullptr;
 }
 
+/**
+ * Read data from the XDBF data area.
+ * Uses the preloaded data blob if available;
+ * otherwise, reads directly from the file.
+ * @param addr Address within the file.
+ * @param buf Output buffer.
+ * @param size Amount to read.
+ * @return Number of bytes read.
+ */
+size_t Xbox360_XDBF_Private::readData(uint32_t addr, void *buf, size_t size) const
+{
+	if (!dataBlob.empty() && addr >= data_offset) {
+		const size_t offset = addr - data_offset;
+		// NOTE: Subtraction form so an attacker-controlled
+		// offset can't overflow the bounds check.
+		if (offset <= dataBlob.size() && size <= dataBlob.size() - offset) {
+			// Data is in the preloaded blob.
+			memcpy(buf, dataBlob.data() + offset, size);
+			return size;
+		}
+	}
+
+	// Not in the preloaded blob.
+	// Read directly from the file.
+	if (!file) {
+		return 0;
+	}
+	return file->seekAndRead(addr, buf, size);
+}
+
 /**
  * Load a string table.
  * @param language_id Language ID.
@@ -279,13 +383,14 @@ const ao::uvector<char> *Xbox360_XDBF_Private::loadStringTable(XDBF_Language_e l
 		// Size is out of range.
 		return nullptr;
 	}
-	ao::uvector<char> *vec = new ao::uvector<char>(str_tbl_sz);
+	// NOTE: unique_ptr<> so the error paths don't have to
+	// delete the vector manually; release()'d on success.
+	unique_ptr<ao::uvector<char> > vec(new ao::uvector<char>(str_tbl_sz));
 
 	const unsigned int str_tbl_addr = be32_to_cpu(entry->offset) + this->data_offset;
-	size_t size = file->seekAndRead(str_tbl_addr, vec->data(), str_tbl_sz);
+	size_t size = readData(str_tbl_addr, vec->data(), str_tbl_sz);
 	if (size != str_tbl_sz) {
 		// Seek and/or read error.
-		delete vec;
 		return nullptr;
 	}
 
@@ -297,13 +402,34 @@ const ao::uvector<char> *Xbox360_XDBF_Private::loadStringTable(XDBF_Language_e l
 	{
 		// Magic is invalid.
 		// TODO: Report an error?
-		delete vec;
 		return nullptr;
 	}
 
+	// Index the string table so loadString() doesn't have to
+	// walk the whole blob on every lookup.
+	// NOTE: String IDs are indexed in big-endian form, as stored.
+	auto &idx = this->strTblIdx[language_id];
+	const char *p = vec->data() + sizeof(XDBF_XSTR_Header);
+	const char *const p_end = vec->data() + vec->size();
+	while (p + sizeof(XDBF_XSTR_Entry_Header) <= p_end) {
+		const XDBF_XSTR_Entry_Header *const entryHdr =
+			reinterpret_cast<const XDBF_XSTR_Entry_Header*>(p);
+		const uint16_t length = be16_to_cpu(entryHdr->length);
+		const char *const p_str = p + sizeof(XDBF_XSTR_Entry_Header);
+		if (p_str + length > p_end) {
+			// String goes out of bounds.
+			break;
+		}
+		// NOTE: insert() does not overwrite existing entries,
+		// which matches the old scan's first-match behavior.
+		idx.insert(std::make_pair(entryHdr->string_id, std::make_pair(
+			static_cast<uint32_t>(p_str - vec->data()), length)));
+		p = p_str + length;
+	}
+
 	// String table loaded successfully.
-	this->strTbl[language_id] = vec;
-	return vec;
+	this->strTbl[language_id] = vec.release();
+	return this->strTbl[language_id];
 }
 
 /**
@@ -321,6 +447,15 @@ string Xbox360_XDBF_Private::loadString(XDBF_Language_e language_id, uint16_t st
 	if (language_id < 0 || language_id >= XDBF_LANGUAGE_MAX)
 		return ret;
 
+	// Is the string already cached?
+	// NOTE: Not-found results are cached as empty strings.
+	const uint32_t cache_key = (static_cast<uint32_t>(language_id) << 16) | string_id;
+	auto cache_iter = map_strCache.find(cache_key);
+	if (cache_iter != map_strCache.end()) {
+		// String is already cached.
+		return cache_iter->second;
+	}
+
 	// Get the string table.
 	const ao::uvector<char> *vec = strTbl[language_id];
 	if (!vec) {
@@ -336,37 +471,20 @@ string Xbox360_XDBF_Private::loadString(XDBF_Language_e language_id, uint16_t st
 	string_id = cpu_to_be16(string_id);
 #endif /* SYS_BYTEORDER == SYS_LIL_ENDIAN */
 
-	// TODO: Optimize by creating an unordered_map of IDs to strings?
-	// Might not be a good optimization if we don't have that many strings...
-
-	// Search for the specified string.
-	const char *p = vec->data() + sizeof(XDBF_XSTR_Header);
-	const char *const p_end = p + vec->size() - sizeof(XDBF_XSTR_Header);
-	while (p < p_end) {
-		// TODO: Verify alignment.
-		const XDBF_XSTR_Entry_Header *const hdr =
-			reinterpret_cast<const XDBF_XSTR_Entry_Header*>(p);
-		const uint16_t length = be16_to_cpu(hdr->length);
-		if (hdr->string_id == string_id) {
-			// Found the string.
-			// Verify that it doesn't go out of bounds.
-			const char *const p_str = p + sizeof(XDBF_XSTR_Entry_Header);
-			const char *const p_str_end = p_str + length;
-			if (p_str_end <= p_end) {
-				// Bounds are OK.
-				// Character set conversion isn't needed, since
-				// the string table is UTF-8, but we do need to
-				// convert from DOS to UNIX line endings.
-				ret = dos2unix(p_str, length);
-			}
-			break;
-		} else {
-			// Not the requested string.
-			// Go to the next string.
-			p += sizeof(XDBF_XSTR_Entry_Header) + length;
-		}
+	// Look up the string in the index built by loadStringTable().
+	// Bounds were verified when the index was built.
+	const auto &idx = strTblIdx[language_id];
+	auto iter = idx.find(string_id);
+	if (iter != idx.end()) {
+		// Found the string.
+		// Character set conversion isn't needed, since
+		// the string table is UTF-8, but we do need to
+		// convert from DOS to UNIX line endings.
+		ret = dos2unix(vec->data() + iter->second.first, iter->second.second);
 	}
 
+	// Cache the result for subsequent lookups.
+	map_strCache.insert(std::make_pair(cache_key, ret));
 	return ret;
 }
 
@@ -378,22 +496,35 @@ XDBF_Language_e Xbox360_XDBF_Private::getLangID(void) const
 {
 	// TODO: Show the default language (XSTC) in a field?
 	// (for both Xbox360_XDBF and Xbox360_XEX)
-	if (m_langID != XDBF_LANGUAGE_UNKNOWN) {
-		// We already got the language ID.
+	if (m_langID_resolved) {
+		// We already resolved the language ID.
+		// NOTE: May be XDBF_LANGUAGE_UNKNOWN if resolution
+		// failed; in that case, don't retry the resolution.
 		return m_langID;
 	}
 
 	// Non-const pointer.
 	Xbox360_XDBF_Private *const ncthis = const_cast<Xbox360_XDBF_Private*>(this);
+	ncthis->m_langID = ncthis->resolveLangID();
+	ncthis->m_langID_resolved = true;
+	return m_langID;
+}
 
+/**
+ * Resolve the language ID for the title fields.
+ * Called by getLangID() the first time it's needed;
+ * use getLangID() instead of calling this directly.
+ * @return XDBF language ID, or XDBF_LANGUAGE_UNKNOWN on error.
+ */
+XDBF_Language_e Xbox360_XDBF_Private::resolveLangID(void)
+{
 	// Get the system language.
 	const XDBF_Language_e langID = static_cast<XDBF_Language_e>(XboxLanguage::getXbox360Language());
 	if (langID > XDBF_LANGUAGE_UNKNOWN && langID < XDBF_LANGUAGE_MAX) {
 		// System language obtained.
 		// Make sure the string table exists.
-		if (ncthis->loadStringTable(langID) != nullptr) {
+		if (loadStringTable(langID) != nullptr) {
 			// String table loaded.
-			ncthis->m_langID = langID;
 			return langID;
 		}
 	}
@@ -414,7 +545,7 @@ XDBF_Language_e Xbox360_XDBF_Private::getLangID(void) const
 	}
 	
 	XDBF_XSTC xstc;
-	size_t size = file->seekAndRead(addr, &xstc, sizeof(xstc));
+	size_t size = readData(addr, &xstc, sizeof(xstc));
 	if (size != sizeof(xstc)) {
 		// Seek and/or read error.
 		return XDBF_LANGUAGE_UNKNOWN;
@@ -440,18 +571,16 @@ XDBF_Language_e Xbox360_XDBF_Private::getLangID(void) const
 
 		// Default language obtained.
 		// Make sure the string table exists.
-		if (ncthis->loadStringTable(langID_xstc) != nullptr) {
+		if (loadStringTable(langID_xstc) != nullptr) {
 			// String table loaded.
-			ncthis->m_langID = langID_xstc;
 			return langID_xstc;
 		}
 	}
 
 	// One last time: Try using English as a fallback language.
 	if (langID != XDBF_LANGUAGE_ENGLISH && langID_xstc != XDBF_LANGUAGE_ENGLISH) {
-		if (ncthis->loadStringTable(XDBF_LANGUAGE_ENGLISH) != nullptr) {
+		if (loadStringTable(XDBF_LANGUAGE_ENGLISH) != nullptr) {
 			// String table loaded.
-			ncthis->m_langID = XDBF_LANGUAGE_ENGLISH;
 			return XDBF_LANGUAGE_ENGLISH;
 		}
 	}
@@ -508,7 +637,7 @@ rp_image *Xbox360_XDBF_Private::loadImage(uint64_t image_id)
 	}
 
 	unique_ptr<uint8_t[]> png_buf(new uint8_t[length]);
-	size_t size = file->seekAndRead(addr, png_buf.get(), length);
+	size_t size = readData(addr, png_buf.get(), length);
 	if (size != length) {
 		// Seek and/or read error.
 		return nullptr;
@@ -522,7 +651,7 @@ rp_image *Xbox360_XDBF_Private::loadImage(uint64_t image_id)
 
 	if (img) {
 		// Save the image for later use.
-		map_images.insert(std::make_pair(image_id, img));
+		map_images.emplace(image_id, img);
 	}
 
 	return img;
@@ -559,28 +688,6 @@ const rp_image *Xbox360_XDBF_Private::loadIcon(void)
  */
 const char *Xbox360_XDBF_Private::getTitleType(void) const
 {
-	// Get the XTHD struct.
-	// TODO: Cache it?
-	const XDBF_Entry *const entry = findResource(XDBF_SPA_NAMESPACE_METADATA, XDBF_XTHD_MAGIC);
-	if (!entry) {
-		// Not found...
-		return nullptr;
-	}
-
-	// Load the XTHD entry.
-	const uint32_t addr = be32_to_cpu(entry->offset) + data_offset;
-	if (be32_to_cpu(entry->length) != sizeof(XDBF_XTHD)) {
-		// Invalid size.
-		return nullptr;
-	}
-
-	XDBF_XTHD xthd;
-	size_t size = file->seekAndRead(addr, &xthd, sizeof(xthd));
-	if (size != sizeof(xthd)) {
-		// Seek and/or read error.
-		return nullptr;
-	}
-
 	static const char *const title_type_tbl[] = {
 		NOP_C_("Xbox360_XDBF|TitleType", "System Title"),
 		NOP_C_("Xbox360_XDBF|TitleType", "Full Game"),
@@ -588,10 +695,44 @@ const char *Xbox360_XDBF_Private::getTitleType(void) const
 		NOP_C_("Xbox360_XDBF|TitleType", "Download"),
 	};
 
-	const uint32_t title_type = be32_to_cpu(xthd.title_type);
-	if (title_type < ARRAY_SIZE(title_type_tbl)) {
+	if (!m_titleType_resolved) {
+		// Read the XTHD struct and cache the title type.
+		// NOTE: The index is cached instead of the string so
+		// the translation is still looked up per call in case
+		// the language changes at runtime.
+		Xbox360_XDBF_Private *const ncthis = const_cast<Xbox360_XDBF_Private*>(this);
+		ncthis->m_titleType_resolved = true;
+
+		// Get the XTHD struct.
+		const XDBF_Entry *const entry = findResource(XDBF_SPA_NAMESPACE_METADATA, XDBF_XTHD_MAGIC);
+		if (!entry) {
+			// Not found...
+			return nullptr;
+		}
+
+		// Load the XTHD entry.
+		const uint32_t addr = be32_to_cpu(entry->offset) + data_offset;
+		if (be32_to_cpu(entry->length) != sizeof(XDBF_XTHD)) {
+			// Invalid size.
+			return nullptr;
+		}
+
+		XDBF_XTHD xthd;
+		size_t size = readData(addr, &xthd, sizeof(xthd));
+		if (size != sizeof(xthd)) {
+			// Seek and/or read error.
+			return nullptr;
+		}
+
+		const uint32_t title_type = be32_to_cpu(xthd.title_type);
+		if (title_type < ARRAY_SIZE(title_type_tbl)) {
+			ncthis->m_titleType = static_cast<int>(title_type);
+		}
+	}
+
+	if (m_titleType >= 0) {
 		return dpgettext_expr(RP_I18N_DOMAIN, "Xbox360_XDBF|TitleType",
-			title_type_tbl[title_type]);
+			title_type_tbl[m_titleType]);
 	}
 
 	// Not found...
@@ -667,7 +808,7 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 	}
 
 	unique_ptr<uint8_t[]> xach_buf(new uint8_t[length]);
-	size_t size = file->seekAndRead(addr, xach_buf.get(), length);
+	size_t size = readData(addr, xach_buf.get(), length);
 	if (size != length) {
 		// Seek and/or read error.
 		return 5;
@@ -715,6 +856,12 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 	vector<string> *const v_xach_col_names = RomFields::strArrayToVector_i18n(
 		"Xbox360_XDBF|Achievements", xach_col_names, ARRAY_SIZE(xach_col_names));
 
+#ifdef HAVE_UNORDERED_MAP_RESERVE
+	// Achievements typically share icons, but reserve space for
+	// the worst case to avoid rehashing mid-loop.
+	map_images.reserve(xach_count + 1);
+#endif /* HAVE_UNORDERED_MAP_RESERVE */
+
 	// Vectors.
 	auto vv_xach = new vector<vector<string> >(xach_count);
 	auto vv_icons = new vector<const rp_image*>(xach_count);
@@ -724,12 +871,17 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 	{
 		// String data row
 		auto &data_row = *xach_iter;
+		data_row.reserve(3);	// 3 columns per row.
 
 		// Icon
 		*icon_iter = loadImage(be32_to_cpu(p->image_id));
 
 		// Achievement ID
-		data_row.push_back(rp_sprintf("%u", be16_to_cpu(p->achievement_id)));
+		// NOTE: Fixed format and not translatable,
+		// so snprintf() is used directly.
+		char buf[16];
+		int len = snprintf(buf, sizeof(buf), "%u", be16_to_cpu(p->achievement_id));
+		data_row.push_back(string(buf, len));
 
 		// Title and locked description
 		// TODO: Unlocked description?
@@ -747,6 +899,7 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 			string lck_desc = loadString(langID, desc_id);
 			if (!lck_desc.empty()) {
 				if (!desc.empty()) {
+					desc.reserve(desc.size() + 1 + lck_desc.size());
 					desc += '\n';
 					desc += lck_desc;
 				} else {
@@ -767,7 +920,8 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 		}
 
 		// Gamerscore
-		data_row.push_back(rp_sprintf("%u", be16_to_cpu(p->gamerscore)));
+		len = snprintf(buf, sizeof(buf), "%u", be16_to_cpu(p->gamerscore));
+		data_row.push_back(string(buf, len));
 	}
 
 	// Add the list data.
@@ -824,7 +978,7 @@ int Xbox360_XDBF_Private::addFields_avatarAwards(void)
 	}
 
 	unique_ptr<uint8_t[]> xgaa_buf(new uint8_t[length]);
-	size_t size = file->seekAndRead(addr, xgaa_buf.get(), length);
+	size_t size = readData(addr, xgaa_buf.get(), length);
 	if (size != length) {
 		// Seek and/or read error.
 		return 5;
@@ -875,10 +1029,10 @@ int Xbox360_XDBF_Private::addFields_avatarAwards(void)
 	// The entries are *not* identical; the string IDs are the same,
 	// but other unknown values are not.
 	// TODO: Figure out the unknown values.
-	std::unordered_set<uint16_t> xgaa_ids;
-#ifdef HAVE_UNORDERED_SET_RESERVE
-	xgaa_ids.reserve(xgaa_count);
-#endif /* HAVE_UNORDERED_SET_RESERVE */
+	// NOTE: With at most XGAA_MAX_COUNT entries, a linear scan
+	// of a stack array beats a heap-allocated unordered_set.
+	uint16_t xgaa_ids[XGAA_MAX_COUNT];
+	unsigned int xgaa_ids_len = 0;
 
 	// Vectors.
 	auto vv_xgaa = new vector<vector<string> >(xgaa_count);
@@ -888,20 +1042,32 @@ int Xbox360_XDBF_Private::addFields_avatarAwards(void)
 	for (; p < p_end && xgaa_iter != vv_xgaa->end(); p++, ++icon_iter)
 	{
 		const uint16_t avatar_award_id = be16_to_cpu(p->avatar_award_id);
-		if (xgaa_ids.find(avatar_award_id) != xgaa_ids.end()) {
+		bool is_dupe = false;
+		for (unsigned int i = 0; i < xgaa_ids_len; i++) {
+			if (xgaa_ids[i] == avatar_award_id) {
+				is_dupe = true;
+				break;
+			}
+		}
+		if (is_dupe) {
 			// Duplicate entry.
 			continue;
 		}
-		xgaa_ids.insert(avatar_award_id);
+		xgaa_ids[xgaa_ids_len++] = avatar_award_id;
 
 		// String data row
 		auto &data_row = *xgaa_iter;
+		data_row.reserve(2);	// 2 columns per row.
 
 		// Icon
 		*icon_iter = loadImage(be32_to_cpu(p->image_id));
 
 		// Achievement ID
-		data_row.push_back(rp_sprintf("%u", avatar_award_id));
+		// NOTE: Fixed format and not translatable,
+		// so snprintf() is used directly.
+		char buf[16];
+		int len = snprintf(buf, sizeof(buf), "%u", avatar_award_id);
+		data_row.push_back(string(buf, len));
 
 		// Title and locked description
 		// TODO: Unlocked description?
@@ -919,6 +1085,7 @@ int Xbox360_XDBF_Private::addFields_avatarAwards(void)
 			string lck_desc = loadString(langID, desc_id);
 			if (!lck_desc.empty()) {
 				if (!desc.empty()) {
+					desc.reserve(desc.size() + 1 + lck_desc.size());
 					desc += '\n';
 					desc += lck_desc;
 				} else {
@@ -943,7 +1110,7 @@ int Xbox360_XDBF_Private::addFields_avatarAwards(void)
 	}
 
 	// Resize the data vector in case there were duplicates.
-	vv_xgaa->resize(xgaa_ids.size());
+	vv_xgaa->resize(xgaa_ids_len);
 
 	// Add the list data.
 	// TODO: Improve the display? On KDE, it seems to be limited to
@@ -1026,14 +1193,19 @@ void Xbox360_XDBF::init(void)
 	RP_D(Xbox360_XDBF);
 
 	// Read the Xbox360_XDBF header.
+	// NOTE: Reading speculatively past the header so that for
+	// typical entry table sizes, the table is fetched in the
+	// same read instead of requiring a second one.
+	uint8_t header_buf[4096];
 	d->file->rewind();
-	size_t size = d->file->read(&d->xdbfHeader, sizeof(d->xdbfHeader));
-	if (size != sizeof(d->xdbfHeader)) {
+	size_t size = d->file->read(header_buf, sizeof(header_buf));
+	if (size < sizeof(d->xdbfHeader)) {
 		d->xdbfHeader.magic = 0;
 		d->file->unref();
 		d->file = nullptr;
 		return;
 	}
+	memcpy(&d->xdbfHeader, header_buf, sizeof(d->xdbfHeader));
 
 	// Check if this file is supported.
 	DetectInfo info;
@@ -1069,14 +1241,60 @@ void Xbox360_XDBF::init(void)
 	// Read the entry table.
 	const size_t entry_table_sz = d->xdbfHeader.entry_table_length * sizeof(XDBF_Entry);
 	d->entryTable = new XDBF_Entry[d->xdbfHeader.entry_table_length];
-	size = d->file->read(d->entryTable, entry_table_sz);
-	if (size != entry_table_sz) {
-		// Read error.
-		delete[] d->entryTable;
-		d->entryTable = nullptr;
-		d->xdbfHeader.magic = 0;
-		d->file->unref();
-		d->file = nullptr;
+	if (sizeof(d->xdbfHeader) + entry_table_sz <= size) {
+		// The entire entry table was included in the
+		// speculative read. No second read is needed.
+		memcpy(d->entryTable, &header_buf[sizeof(d->xdbfHeader)], entry_table_sz);
+	} else {
+		// Entry table is too big for the speculative read.
+		// Read it from the file.
+		size = d->file->seekAndRead(sizeof(d->xdbfHeader), d->entryTable, entry_table_sz);
+		if (size != entry_table_sz) {
+			// Seek and/or read error.
+			delete[] d->entryTable;
+			d->entryTable = nullptr;
+			d->xdbfHeader.magic = 0;
+			d->file->unref();
+			d->file = nullptr;
+			return;
+		}
+	}
+
+	// Build the resource map for O(1) lookups.
+	// The composite key is the namespace ID in the high 16 bits
+	// and the resource ID in the low 48 bits. If a resource ID
+	// doesn't fit, findResource() falls back to a linear scan.
+#ifdef HAVE_UNORDERED_MAP_RESERVE
+	d->map_resources.reserve(d->xdbfHeader.entry_table_length);
+#endif /* HAVE_UNORDERED_MAP_RESERVE */
+	const XDBF_Entry *p = d->entryTable;
+	const XDBF_Entry *const p_end = p + d->xdbfHeader.entry_table_length;
+	for (; p < p_end; p++) {
+		const uint64_t resource_id = be64_to_cpu(p->resource_id);
+		if (resource_id > XDBF_RES_MAP_ID_MASK) {
+			// Resource ID doesn't fit in the key.
+			d->map_resources.clear();
+			break;
+		}
+		const uint64_t key = (static_cast<uint64_t>(be16_to_cpu(p->namespace_id)) << 48) | resource_id;
+		// NOTE: insert() does not overwrite existing entries,
+		// which matches the linear scan's first-match behavior.
+		d->map_resources.insert(std::make_pair(key, p));
+	}
+
+	// If the data area is small enough, preload the whole thing
+	// so individual resource loads don't have to seek.
+	const int64_t fileSize = d->file->size();
+	if (fileSize > d->data_offset &&
+	    fileSize - d->data_offset <= XDBF_DATA_PRELOAD_MAX)
+	{
+		const size_t data_size = static_cast<size_t>(fileSize) - d->data_offset;
+		d->dataBlob.resize(data_size);
+		size = d->file->seekAndRead(d->data_offset, d->dataBlob.data(), data_size);
+		if (size != data_size) {
+			// Unable to preload the data area.
+			d->dataBlob.clear();
+		}
 	}
 }
 
@@ -0,0 +1,110 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata/tests)                 *
+ * WiiUDiscHeaderTest.cpp: Wii U disc header detection test.               *
+ *                                                                         *
+ * Copyright (c) 2019 by David Korth.                                      *
+ * SPDX-License-Identifier: GPL-2.0-or-later                               *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// WiiU
+#include "librpbase/common.h"
+#include "librpbase/RomData.hpp"
+#include "../Console/WiiU.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+namespace LibRomData { namespace Tests {
+
+class WiiUDiscHeaderTest : public ::testing::Test
+{
+	protected:
+		WiiUDiscHeaderTest() { }
+
+	public:
+		// Known-good Wii U disc header.
+		static const char disc_header[22];
+
+		/**
+		 * Run WiiU::isRomSupported_static() on a test header.
+		 * @param header Header data.
+		 * @param size Size of header.
+		 * @return WiiU::isRomSupported_static() return value.
+		 */
+		static int isRomSupported(const uint8_t *header, size_t size);
+};
+
+// Known-good Wii U disc header.
+// NOTE: Not NULL-terminated!
+const char WiiUDiscHeaderTest::disc_header[22] =
+	{'W','U','P','-','P','-','A','R','D','E',
+	 '-','0','0','-','5','5','1','U','S','A',
+	 '-','0'};
+
+/**
+ * Run WiiU::isRomSupported_static() on a test header.
+ * @param header Header data.
+ * @param size Size of header.
+ * @return WiiU::isRomSupported_static() return value.
+ */
+int WiiUDiscHeaderTest::isRomSupported(const uint8_t *header, size_t size)
+{
+	LibRpBase::RomData::DetectInfo info;
+	info.header.addr = 0;
+	info.header.size = static_cast<uint32_t>(size);
+	info.header.pData = header;
+	info.ext = nullptr;
+	info.szFile = 0x20000;	// Minimum size for Wii U disc images.
+	return WiiU::isRomSupported_static(&info);
+}
+
+/**
+ * Make sure a known-good disc header is detected.
+ */
+TEST_F(WiiUDiscHeaderTest, knownGoodHeader)
+{
+	uint8_t header[256];
+	memset(header, 0, sizeof(header));
+	memcpy(header, disc_header, sizeof(disc_header));
+	EXPECT_GE(isRomSupported(header, sizeof(header)), 0)
+		<< "Known-good Wii U disc header was not detected.";
+}
+
+/**
+ * Make sure headers with a missing hyphen are rejected.
+ */
+TEST_F(WiiUDiscHeaderTest, missingHyphen)
+{
+	// Hyphen offsets within the disc header.
+	static const uint8_t hyphen_offsets[] = {3, 5, 10, 13, 20};
+
+	uint8_t header[256];
+	for (unsigned int i = 0; i < ARRAY_SIZE(hyphen_offsets); i++) {
+		memset(header, 0, sizeof(header));
+		memcpy(header, disc_header, sizeof(disc_header));
+		header[hyphen_offsets[i]] = 'x';
+		EXPECT_LT(isRomSupported(header, sizeof(header)), 0)
+			<< "Header with missing hyphen at offset "
+			<< static_cast<unsigned int>(hyphen_offsets[i])
+			<< " was detected as valid.";
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRomData test suite: Wii U disc header tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -46,4 +46,44 @@ void SuperMagicDrive::decodeBlock_cpp(uint8_t *RESTRICT pDest, const uint8_t *RE
 	}
 }
 
+/**
+ * Decode the first 512 bytes of a Super Magic Drive interleaved block.
+ *
+ * This covers the M68K vector table and the MD-style ROM
+ * header, so callers that only need the header don't have
+ * to deinterleave the other 15.5 KB of the block.
+ *
+ * @param pDest	[out] Destination buffer. (Must be 512 bytes.)
+ * @param pSrc	[in] Source block. (Must be 16 KB.)
+ */
+void SuperMagicDrive::decodeHeader(uint8_t *RESTRICT pDest, const uint8_t *RESTRICT pSrc)
+{
+	// First 8 KB of the source block is ODD bytes.
+	const uint8_t *pSrc_end = pSrc + (512 / 2);
+	for (uint8_t *pDest_odd = pDest + 1; pSrc < pSrc_end; pDest_odd += 16, pSrc += 8) {
+		pDest_odd[ 0] = pSrc[0];
+		pDest_odd[ 2] = pSrc[1];
+		pDest_odd[ 4] = pSrc[2];
+		pDest_odd[ 6] = pSrc[3];
+		pDest_odd[ 8] = pSrc[4];
+		pDest_odd[10] = pSrc[5];
+		pDest_odd[12] = pSrc[6];
+		pDest_odd[14] = pSrc[7];
+	}
+
+	// Second 8 KB of the source block is EVEN bytes.
+	pSrc += (SMD_BLOCK_SIZE / 2) - (512 / 2);
+	pSrc_end = pSrc + (512 / 2);
+	for (uint8_t *pDest_even = pDest; pSrc < pSrc_end; pDest_even += 16, pSrc += 8) {
+		pDest_even[ 0] = pSrc[ 0];
+		pDest_even[ 2] = pSrc[ 1];
+		pDest_even[ 4] = pSrc[ 2];
+		pDest_even[ 6] = pSrc[ 3];
+		pDest_even[ 8] = pSrc[ 4];
+		pDest_even[10] = pSrc[ 5];
+		pDest_even[12] = pSrc[ 6];
+		pDest_even[14] = pSrc[ 7];
+	}
+}
+
 }
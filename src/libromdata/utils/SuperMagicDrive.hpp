@@ -77,6 +77,18 @@ class SuperMagicDrive
 		// SMD block size.
 		static const unsigned int SMD_BLOCK_SIZE = 16384;
 
+		/**
+		 * Decode the first 512 bytes of a Super Magic Drive interleaved block.
+		 *
+		 * This covers the M68K vector table and the MD-style ROM
+		 * header, so callers that only need the header don't have
+		 * to deinterleave the other 15.5 KB of the block.
+		 *
+		 * @param pDest	[out] Destination buffer. (Must be 512 bytes.)
+		 * @param pSrc	[in] Source block. (Must be 16 KB.)
+		 */
+		static void decodeHeader(uint8_t *RESTRICT pDest, const uint8_t *RESTRICT pSrc);
+
 		/**
 		 * Decode a Super Magic Drive interleaved block.
 		 * NOTE: Pointers must be 16-byte aligned if using SSE2.
@@ -18,6 +18,7 @@
 #include "librpbase/ctypex.h"
 #include <cassert>
 #include <cerrno>
+#include <cstring>
 #include <ctime>
 
 // C++ includes.
@@ -158,6 +158,21 @@ static inline void codePageToEncName(char *enc_name, size_t len, unsigned int cp
 	}
 }
 
+/**
+ * Check if the specified text is entirely ASCII.
+ * @param str Text.
+ * @param len Length of str, in bytes.
+ * @return True if the text is entirely ASCII; false if not.
+ */
+static inline bool is_ascii(const char *str, int len)
+{
+	uint8_t acc = 0;
+	for (int i = 0; i < len; i++) {
+		acc |= static_cast<uint8_t>(str[i]);
+	}
+	return !(acc & 0x80);
+}
+
 /**
  * Convert 8-bit text to UTF-8.
  * Trailing NULL bytes will be removed.
@@ -174,6 +189,14 @@ string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags
 {
 	len = check_NULL_terminator(str, len);
 
+	// Fast path: If the text is entirely ASCII, return it as-is.
+	// All code pages used with this function are ASCII-compatible
+	// in the 7-bit range, and ASCII is valid UTF-8, so the iconv
+	// round trip is a no-op for these strings.
+	if (is_ascii(str, len)) {
+		return string(str, len);
+	}
+
 	// Get the encoding name for the primary code page.
 	char cp_name[20];
 	codePageToEncName(cp_name, sizeof(cp_name), cp, flags);
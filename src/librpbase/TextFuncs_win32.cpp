@@ -129,6 +129,21 @@ static char *W32U_UTF16_to_mbs(const char16_t *wcs, int cchWcs,
 
 /** Generic code page functions. **/
 
+/**
+ * Check if the specified text is entirely ASCII.
+ * @param str Text.
+ * @param len Length of str, in bytes.
+ * @return True if the text is entirely ASCII; false if not.
+ */
+static inline bool is_ascii(const char *str, int len)
+{
+	uint8_t acc = 0;
+	for (int i = 0; i < len; i++) {
+		acc |= static_cast<uint8_t>(str[i]);
+	}
+	return !(acc & 0x80);
+}
+
 /**
  * Convert 8-bit text to UTF-8.
  * Trailing NULL bytes will be removed.
@@ -144,6 +159,15 @@ static char *W32U_UTF16_to_mbs(const char16_t *wcs, int cchWcs,
 string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags)
 {
 	len = check_NULL_terminator(str, len);
+
+	// Fast path: If the text is entirely ASCII, return it as-is.
+	// All code pages used with this function are ASCII-compatible
+	// in the 7-bit range, and ASCII is valid UTF-8, so the code
+	// page round trip is a no-op for these strings.
+	if (is_ascii(str, len)) {
+		return string(str, len);
+	}
+
 	DWORD dwFlags = 0;
 	if (flags & TEXTCONV_FLAG_CP1252_FALLBACK) {
 		// Fallback is enabled.
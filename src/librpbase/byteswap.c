@@ -13,14 +13,14 @@
 #include <assert.h>
 
 /**
- * Byteswap two 16-bit WORDs in a 32-bit DWORD.
- * @param dword DWORD containing two 16-bit WORDs.
- * @return DWORD containing the byteswapped 16-bit WORDs.
+ * Byteswap four 16-bit WORDs in a 64-bit QWORD.
+ * @param qword QWORD containing four 16-bit WORDs.
+ * @return QWORD containing the byteswapped 16-bit WORDs.
  */
-static inline uint32_t swap_two_16_in_32(uint32_t dword)
+static inline uint64_t swap_four_16_in_64(uint64_t qword)
 {
-	uint32_t tmp1 = (dword >> 8) & 0x00FF00FF;
-	uint32_t tmp2 = (dword << 8) & 0xFF00FF00;
+	uint64_t tmp1 = (qword >> 8) & 0x00FF00FF00FF00FFULL;
+	uint64_t tmp2 = (qword << 8) & 0xFF00FF00FF00FF00ULL;
 	return (tmp1 | tmp2);
 }
 
@@ -32,7 +32,7 @@ static inline uint32_t swap_two_16_in_32(uint32_t dword)
  */
 void __byte_swap_16_array_c(uint16_t *ptr, unsigned int n)
 {
-	uint32_t *dwptr;
+	uint64_t *qwptr;
 
 	// Verify the block is 16-bit aligned
 	// and is a multiple of 2 bytes.
@@ -40,23 +40,20 @@ void __byte_swap_16_array_c(uint16_t *ptr, unsigned int n)
 	assert((n & 1) == 0);
 	n &= ~1;
 
-	// Check if ptr is 32-bit aligned.
-	if (((uintptr_t)ptr & 3) != 0) {
-		// Byteswap the first WORD to fix alignment.
+	// If ptr isn't 64-bit aligned, swap WORDs
+	// manually until we get to 64-bit alignment.
+	for (; ((uintptr_t)ptr & 7) != 0 && n > 0; n -= 2, ptr++) {
 		*ptr = __swab16(*ptr);
-		ptr++;
 	}
 
 	// Process 8 WORDs per iteration,
-	// using 32-bit accesses.
-	dwptr = (uint32_t*)ptr;
-	for (; n >= 16; n -= 16, dwptr += 4) {
-		dwptr[0] = swap_two_16_in_32(dwptr[0]);
-		dwptr[1] = swap_two_16_in_32(dwptr[1]);
-		dwptr[2] = swap_two_16_in_32(dwptr[2]);
-		dwptr[3] = swap_two_16_in_32(dwptr[3]);
+	// using 64-bit accesses.
+	qwptr = (uint64_t*)ptr;
+	for (; n >= 16; n -= 16, qwptr += 2) {
+		qwptr[0] = swap_four_16_in_64(qwptr[0]);
+		qwptr[1] = swap_four_16_in_64(qwptr[1]);
 	}
-	ptr = (uint16_t*)dwptr;
+	ptr = (uint16_t*)qwptr;
 
 	// Process remaining WORDs.
 	for (; n > 0; n -= 2, ptr++) {
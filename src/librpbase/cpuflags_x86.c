@@ -51,6 +51,8 @@
 
 // Flags stored in the %ebx register.
 #define CPUFLAG_IA32_FN7_EBX_AVX2	((uint32_t)(1U << 5))
+#define CPUFLAG_IA32_FN7_EBX_AVX512F	((uint32_t)(1U << 16))
+#define CPUFLAG_IA32_FN7_EBX_AVX512BW	((uint32_t)(1U << 30))
 
 // CPUID function 0x80000001: Extended Processor Info and Feature Bits
 
@@ -134,6 +136,8 @@ static FORCEINLINE int is_cpuid_supported(void)
 
 /**
  * Run the `cpuid` instruction.
+ * %ecx is zeroed before running `cpuid` in order to get
+ * subleaf 0 for leaves that use subleaves, e.g. Function 7.
  * @param level
  * @param regs Registers. (%eax, %ebx, %ecx, %edx)
  */
@@ -148,19 +152,23 @@ static FORCEINLINE void cpuid(unsigned int level, unsigned int regs[4])
 		"cpuid\n"
 		"xchgl	%%ebx, %1\n"
 		: "=a" (regs[0]), "=r" (regs[1]), "=c" (regs[2]), "=d" (regs[3])
-		: "0" (level)
+		: "0" (level), "2" (0)
 		);
 # else /* !ASM_RESERVE_EBX */
 	__asm__ (
 		"cpuid\n"
 		: "=a" (regs[0]), "=b" (regs[1]), "=c" (regs[2]), "=d" (regs[3])
-		: "0" (level)
+		: "0" (level), "2" (0)
 		);
 # endif
 #elif defined(_MSC_VER)
-# if _MSC_VER >= 1400
-	// CPUID for MSVC 2005+
-	// Uses the __cpuid() intrinsic.
+# if _MSC_VER >= 1500
+	// CPUID for MSVC 2008+
+	// Uses the __cpuidex() intrinsic, which sets %ecx.
+	__cpuidex((int*)regs, level, 0);
+# elif _MSC_VER >= 1400
+	// CPUID for MSVC 2005.
+	// Uses the __cpuid() intrinsic, which zeroes %ecx.
 	__cpuid((int*)regs, level);
 # else /* _MSC_VER < 1400 */
 	// CPUID for old MSVC that doesn't support intrinsics.
@@ -169,6 +177,7 @@ static FORCEINLINE void cpuid(unsigned int level, unsigned int regs[4])
 #   error Cannot use inline assembly on 64-bit MSVC.
 #  endif
 	__asm {
+		xor	ecx, ecx
 		cpuid
 		mov	regs[0 * TYPE int], eax
 		mov	regs[1 * TYPE int], ebx
@@ -181,6 +190,35 @@ static FORCEINLINE void cpuid(unsigned int level, unsigned int regs[4])
 #endif
 }
 
+/**
+ * Run the `xgetbv` instruction with %ecx == 0.
+ * Used to check if the OS saves YMM state. (XCR0)
+ * NOTE: Only call this function if CPUID function 1
+ * reports OSXSAVE support.
+ * @return Low 32 bits of XCR0.
+ */
+static FORCEINLINE uint32_t rp_xgetbv(void)
+{
+#if defined(__GNUC__)
+	// Use raw bytes for `xgetbv` to avoid requiring
+	// -mxsave (or -mavx) for this translation unit.
+	uint32_t low, high;
+	__asm__ (
+		".byte	0x0F, 0x01, 0xD0"
+		: "=a" (low), "=d" (high)
+		: "c" (0)
+		);
+	return low;
+#elif defined(_MSC_VER) && _MSC_VER >= 1600
+	// MSVC 2010+: Use the _xgetbv() intrinsic.
+	return (uint32_t)_xgetbv(0);
+#else
+	// No `xgetbv` implementation for this compiler.
+	// Assume YMM state saving is not supported.
+	return 0;
+#endif
+}
+
 // Register indexes.
 #define REG_EAX 0
 #define REG_EBX 1
@@ -303,6 +341,37 @@ static void RP_CPU_InitCPUFlags_int(void)
 		if (regs[REG_ECX] & CPUFLAG_IA32_ECX_SSE42)
 			RP_CPU_Flags |= RP_CPUFLAG_X86_SSE42;
 #endif /* defined(__i386__) || defined(_M_IX86) */
+
+		// Check for AVX.
+		// Unlike SSE, AVX requires XSAVE instead of FXSAVE,
+		// so we have to check for OSXSAVE and then verify
+		// that the OS is saving YMM state via XCR0.
+		if ((regs[REG_ECX] & (CPUFLAG_IA32_ECX_OSXSAVE | CPUFLAG_IA32_ECX_AVX)) ==
+		     (CPUFLAG_IA32_ECX_OSXSAVE | CPUFLAG_IA32_ECX_AVX))
+		{
+			// XCR0 bits 1 and 2: XMM and YMM state saving.
+			const uint32_t xcr0 = rp_xgetbv();
+			if ((xcr0 & 0x06) == 0x06) {
+				// OS is saving YMM state.
+				RP_CPU_Flags |= RP_CPUFLAG_X86_AVX;
+
+				// Check for AVX2 and AVX-512. (CPUID function 7)
+				if (maxFunc >= CPUID_EXT_FEATURES) {
+					cpuid(CPUID_EXT_FEATURES, regs);
+					if (regs[REG_EBX] & CPUFLAG_IA32_FN7_EBX_AVX2)
+						RP_CPU_Flags |= RP_CPUFLAG_X86_AVX2;
+
+					// AVX-512 additionally requires opmask and
+					// ZMM state saving. (XCR0 bits 5-7)
+					if ((xcr0 & 0xE6) == 0xE6 &&
+					    (regs[REG_EBX] & (CPUFLAG_IA32_FN7_EBX_AVX512F | CPUFLAG_IA32_FN7_EBX_AVX512BW)) ==
+					     (CPUFLAG_IA32_FN7_EBX_AVX512F | CPUFLAG_IA32_FN7_EBX_AVX512BW))
+					{
+						RP_CPU_Flags |= RP_CPUFLAG_X86_AVX512BW;
+					}
+				}
+			}
+		}
 	}
 
 	// CPU flags initialized.
@@ -150,6 +150,7 @@ rp_image::rp_image_backend_creator_fn rp_image_private::backend_fn = nullptr;
  */
 rp_image_private::rp_image_private(int width, int height, rp_image::Format format)
 	: has_sBIT(false)
+	, palette_bswapped_valid(false)
 {
 	// Clear the metadata.
 	memset(&sBIT, 0, sizeof(sBIT));
@@ -180,6 +181,7 @@ rp_image_private::rp_image_private(int width, int height, rp_image::Format forma
 rp_image_private::rp_image_private(rp_image_backend *backend)
 	: backend(backend)
 	, has_sBIT(false)
+	, palette_bswapped_valid(false)
 {
 	// Clear the metadata.
 	// TODO: Store sBIT in the backend and copy it?
@@ -418,9 +420,66 @@ const uint32_t *rp_image::palette(void) const
 uint32_t *rp_image::palette(void)
 {
 	RP_D(rp_image);
+	// The caller may modify the palette through this pointer,
+	// so the cached R/B-swapped palette must be invalidated.
+	d->palette_bswapped_valid = false;
 	return d->backend->palette();
 }
 
+/**
+ * Get the image palette with the R and B channels swapped.
+ *
+ * The swapped palette is cached, so repeated UI conversions
+ * of the same image (e.g. redraws of a thumbnail) don't have
+ * to rebuild it every time. The returned palette always has
+ * 256 entries; unused entries are zeroed.
+ *
+ * @return Pointer to 256-entry swapped palette, or nullptr if not a paletted image.
+ */
+const uint32_t *rp_image::palette_bswapped(void) const
+{
+	RP_D(const rp_image);
+	if (d->palette_bswapped_valid) {
+		// Swapped palette is still valid.
+		return d->palette_bswapped;
+	}
+
+	const uint32_t *src_pal = d->backend->palette();
+	const int src_pal_len = d->backend->palette_len();
+	if (!src_pal || src_pal_len <= 0) {
+		// Not a paletted image.
+		return nullptr;
+	}
+
+	// Swap the R and B channels in the palette.
+	uint32_t *dest_pal = d->palette_bswapped;
+	int i;
+	for (i = 0; i+1 < src_pal_len; i += 2) {
+		dest_pal[i+0] = (src_pal[i+0] & 0xFF00FF00) |
+			       ((src_pal[i+0] & 0x00FF0000) >> 16) |
+			       ((src_pal[i+0] & 0x000000FF) << 16);
+		dest_pal[i+1] = (src_pal[i+1] & 0xFF00FF00) |
+			       ((src_pal[i+1] & 0x00FF0000) >> 16) |
+			       ((src_pal[i+1] & 0x000000FF) << 16);
+	}
+	if (i < src_pal_len) {
+		// Last color. (odd palette length)
+		dest_pal[i] = (src_pal[i] & 0xFF00FF00) |
+			     ((src_pal[i] & 0x00FF0000) >> 16) |
+			     ((src_pal[i] & 0x000000FF) << 16);
+		i++;
+	}
+
+	// Zero out the rest of the palette if the
+	// source palette has fewer than 256 entries.
+	if (i < (int)ARRAY_SIZE(d->palette_bswapped)) {
+		memset(&dest_pal[i], 0, (ARRAY_SIZE(d->palette_bswapped) - i) * sizeof(uint32_t));
+	}
+
+	d->palette_bswapped_valid = true;
+	return d->palette_bswapped;
+}
+
 /**
  * Get the number of elements in the image palette.
  * @return Number of elements in the image palette, or 0 if not a paletted image.
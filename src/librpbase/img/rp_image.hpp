@@ -220,6 +220,18 @@ class rp_image
 		 */
 		uint32_t *palette(void);
 
+		/**
+		 * Get the image palette with the R and B channels swapped.
+		 *
+		 * The swapped palette is cached, so repeated UI conversions
+		 * of the same image (e.g. redraws of a thumbnail) don't have
+		 * to rebuild it every time. The returned palette always has
+		 * 256 entries; unused entries are zeroed.
+		 *
+		 * @return Pointer to 256-entry swapped palette, or nullptr if not a paletted image.
+		 */
+		const uint32_t *palette_bswapped(void) const;
+
 		/**
 		 * Get the number of elements in the image palette.
 		 * @return Number of elements in the image palette, or 0 if not a paletted image.
@@ -41,6 +41,18 @@ class rp_image_backend
 		 */
 		bool has_translucent_palette_entries(void) const;
 
+	public:
+		/**
+		 * Get the backend identifier tag.
+		 * Subclasses that need to be identified at runtime should
+		 * override this to return a unique FourCC-style value.
+		 * Callers can then use static_cast<> after an integer
+		 * compare instead of a dynamic_cast<>, which has to walk
+		 * the class hierarchy and compare type_info strings.
+		 * @return Backend identifier, or 0 if not overridden.
+		 */
+		virtual uint32_t backendId(void) const { return 0; }
+
 	public:
 		int width;
 		int height;
@@ -60,7 +72,8 @@ class rp_image_backend
 
 	public:
 		// Subclasses can have other stuff here.
-		// Use dynamic_cast<> to access it.
+		// Use dynamic_cast<> to access it, or check
+		// backendId() and use static_cast<>.
 };
 
 }
@@ -54,6 +54,13 @@ class rp_image_private
 		// Metadata.
 		bool has_sBIT;
 		rp_image::sBIT_t sBIT;
+
+		// Cached R/B-swapped palette for UI conversions.
+		// (CI8 images only; rebuilt on demand)
+		// Invalidated whenever the non-const palette()
+		// accessor is used.
+		mutable uint32_t palette_bswapped[256];
+		mutable bool palette_bswapped_valid;
 };
 
 }
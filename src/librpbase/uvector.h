@@ -124,7 +124,7 @@ class uvector : private Alloc
 #endif /* !CXX_NO_IS_STANDARD_LAYOUT */
 private:
 #if __cplusplus > 201402L
-	typedef std::allocator_traits<allocator_type>::is_always_equal allocator_is_always_equal;
+	typedef typename std::allocator_traits<Alloc>::is_always_equal allocator_is_always_equal;
 #else
 	typedef std::false_type allocator_is_always_equal;
 #endif